@@ -1,11 +1,17 @@
 #include "DurationProtocol.hpp"
 
+#include "Engine.hpp"
 #include "Geometric.hpp"
 #include "Multiples.hpp"
 #include "Prescribed.hpp"
 #include "UniformGenerator.hpp"
 
 namespace aleatoric {
+bool DurationProtocol::hasRandomDurations()
+{
+    return false;
+}
+
 std::unique_ptr<DurationProtocol>
 DurationProtocol::createPrescribed(std::vector<int> durations)
 {
@@ -27,6 +33,28 @@ std::unique_ptr<DurationProtocol> DurationProtocol::createMultiples(
                                        std::make_unique<UniformGenerator>());
 }
 
+std::unique_ptr<DurationProtocol> DurationProtocol::createMultiples(
+    int baseIncrement, Range range, double deviationFactor, std::uint64_t seed)
+{
+    return createMultiples(baseIncrement,
+                           range,
+                           deviationFactor,
+                           std::make_shared<Engine>(seed));
+}
+
+std::unique_ptr<DurationProtocol>
+DurationProtocol::createMultiples(int baseIncrement,
+                                  Range range,
+                                  double deviationFactor,
+                                  std::shared_ptr<Engine> engine)
+{
+    return std::make_unique<Multiples>(
+        baseIncrement,
+        range,
+        deviationFactor,
+        std::make_unique<UniformGenerator>(std::move(engine)));
+}
+
 std::unique_ptr<DurationProtocol>
 DurationProtocol::createMultiples(int baseIncrement,
                                   std::vector<int> multipliers)
@@ -43,6 +71,31 @@ std::unique_ptr<DurationProtocol> DurationProtocol::createMultiples(
                                        std::make_unique<UniformGenerator>());
 }
 
+std::unique_ptr<DurationProtocol>
+DurationProtocol::createMultiples(int baseIncrement,
+                                  std::vector<int> multipliers,
+                                  double deviationFactor,
+                                  std::uint64_t seed)
+{
+    return createMultiples(baseIncrement,
+                           multipliers,
+                           deviationFactor,
+                           std::make_shared<Engine>(seed));
+}
+
+std::unique_ptr<DurationProtocol>
+DurationProtocol::createMultiples(int baseIncrement,
+                                  std::vector<int> multipliers,
+                                  double deviationFactor,
+                                  std::shared_ptr<Engine> engine)
+{
+    return std::make_unique<Multiples>(
+        baseIncrement,
+        multipliers,
+        deviationFactor,
+        std::make_unique<UniformGenerator>(std::move(engine)));
+}
+
 std::unique_ptr<DurationProtocol>
 DurationProtocol::createGeometric(Range range, int collectionSize)
 {
@@ -3,10 +3,12 @@
 
 #include "Range.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 namespace aleatoric {
+class Engine;
 
 class DurationProtocol {
   public:
@@ -16,6 +18,11 @@ class DurationProtocol {
 
     virtual std::vector<int> getSelectableDurations() = 0;
 
+    /*! @brief Returns true if getDuration draws random numbers, so that the
+     * same index can give different durations. Defaults to false; protocols
+     * that draw must override it. */
+    virtual bool hasRandomDurations();
+
     virtual ~DurationProtocol() = default;
 
     static std::unique_ptr<DurationProtocol>
@@ -27,6 +34,18 @@ class DurationProtocol {
     static std::unique_ptr<DurationProtocol>
     createMultiples(int baseIncrement, Range range, double deviationFactor);
 
+    static std::unique_ptr<DurationProtocol>
+    createMultiples(int baseIncrement,
+                    Range range,
+                    double deviationFactor,
+                    std::uint64_t seed);
+
+    static std::unique_ptr<DurationProtocol>
+    createMultiples(int baseIncrement,
+                    Range range,
+                    double deviationFactor,
+                    std::shared_ptr<Engine> engine);
+
     static std::unique_ptr<DurationProtocol>
     createMultiples(int baseIncrement, std::vector<int> multipliers);
 
@@ -35,6 +54,18 @@ class DurationProtocol {
                     std::vector<int> multipliers,
                     double deviationFactor);
 
+    static std::unique_ptr<DurationProtocol>
+    createMultiples(int baseIncrement,
+                    std::vector<int> multipliers,
+                    double deviationFactor,
+                    std::uint64_t seed);
+
+    static std::unique_ptr<DurationProtocol>
+    createMultiples(int baseIncrement,
+                    std::vector<int> multipliers,
+                    double deviationFactor,
+                    std::shared_ptr<Engine> engine);
+
     static std::unique_ptr<DurationProtocol>
     createGeometric(Range range, int collectionSize);
 };
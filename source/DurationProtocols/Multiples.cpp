@@ -102,11 +102,8 @@ int Multiples::getDuration(int index)
         int deviationMin = m_durations.at(index) - potentialDeviation;
         int deviationMax = m_durations.at(index) + potentialDeviation;
 
-        // set the generator to the right range
-        m_generator->setDistribution(deviationMin, deviationMax);
-
-        // get a number and return it
-        return m_generator->getNumber();
+        // get a number from the range and return it
+        return m_generator->getNumber(deviationMin, deviationMax);
     }
 
     return m_durations.at(index);
@@ -117,4 +114,9 @@ std::vector<int> Multiples::getSelectableDurations()
     return m_durations;
 }
 
+bool Multiples::hasRandomDurations()
+{
+    return m_hasDeviationFactor;
+}
+
 } // namespace aleatoric
@@ -29,6 +29,9 @@ class Multiples : public DurationProtocol {
     int getDuration(int index) override;
     std::vector<int> getSelectableDurations() override;
 
+    /*! @brief returns true if the durations deviate */
+    bool hasRandomDurations() override;
+
   private:
     std::vector<int> m_durations;
     double m_deviationFactor;
@@ -0,0 +1,80 @@
+#include "CounterEngine.hpp"
+
+#include "HashedSeedSource.hpp"
+
+namespace aleatoric {
+namespace {
+// NB: the splitmix64 increment, and a second odd constant separating the
+// sub-indices
+const std::uint64_t indexIncrement = 0x9e3779b97f4a7c15ULL;
+const std::uint64_t subIndexIncrement = 0xd1b54a32d192ed03ULL;
+} // namespace
+
+CounterEngine::CounterEngine(std::uint64_t key)
+: m_key(key), m_hashedKey(HashedSeedSource::hash(key)), m_position(0)
+{}
+
+std::uint64_t CounterEngine::getKey() const
+{
+    return m_key;
+}
+
+std::uint64_t CounterEngine::getValue(std::uint64_t index,
+                                      std::uint64_t subIndex) const
+{
+    auto streamKey =
+        subIndex == 0
+            ? m_hashedKey
+            : HashedSeedSource::hash(m_key + subIndex * subIndexIncrement);
+
+    return HashedSeedSource::hash(streamKey + (index + 1) * indexIncrement);
+}
+
+std::uint32_t CounterEngine::getBoundedNumber(std::uint64_t index,
+                                              std::uint32_t bound) const
+{
+    std::uint64_t subIndex = 0;
+    auto draw = [this, index, &subIndex]() {
+        return getValue(index, subIndex++) >> 32;
+    };
+
+    if(bound == 0) {
+        return static_cast<std::uint32_t>(draw());
+    }
+
+    auto product = draw() * bound;
+    auto low = static_cast<std::uint32_t>(product);
+
+    if(low < bound) {
+        std::uint32_t threshold = (0u - bound) % bound;
+
+        while(low < threshold) {
+            product = draw() * bound;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+double CounterEngine::getUnitNumber(std::uint64_t index) const
+{
+    return static_cast<double>(getValue(index) >> 11) *
+           (1.0 / 9007199254740992.0);
+}
+
+std::uint64_t CounterEngine::getPosition() const
+{
+    return m_position;
+}
+
+void CounterEngine::setPosition(std::uint64_t position)
+{
+    m_position = position;
+}
+
+std::uint64_t CounterEngine::takeIndex()
+{
+    return m_position++;
+}
+} // namespace aleatoric
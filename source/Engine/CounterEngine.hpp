@@ -0,0 +1,64 @@
+#ifndef CounterEngine_hpp
+#define CounterEngine_hpp
+
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+@brief A counter-based random number engine in the style of SplitMix
+
+Unlike Engine, which steps a state from one output to the next, the value at
+each index of a CounterEngine is a pure function of the key and the index: a
+hash (the splitmix64 finaliser) of the key and the index. Any value can
+therefore be computed directly, in O(1), without generating the values before
+it, and windows of a sequence can be regenerated in parallel by engines sharing
+a key.
+
+Each draw of a counter based generator (see CounterUniformGenerator and
+CounterDiscreteGenerator) uses the value at one index, so draw n of a
+stateless protocol (e.g. Basic, Precision) can be reached with setPosition(n).
+Draws that need more than one value (e.g. to reject a biased value) take
+them from sub-indices of the same index.
+*/
+class CounterEngine {
+  public:
+    explicit CounterEngine(std::uint64_t key);
+
+    std::uint64_t getKey() const;
+
+    /*! @brief returns the value at an index, as a pure function of the key,
+     * the index and the sub-index */
+    std::uint64_t getValue(std::uint64_t index,
+                           std::uint64_t subIndex = 0) const;
+
+    /*!
+     * @brief Returns a number drawn uniformly from 0 to bound - 1 for an index
+     *
+     * Lemire's nearly divisionless method, as Engine::getBoundedNumber, with
+     * any rejected values replaced from successive sub-indices. A bound of 0
+     * stands for 2^32.
+     */
+    std::uint32_t getBoundedNumber(std::uint64_t index,
+                                   std::uint32_t bound) const;
+
+    /*! @brief returns a number drawn uniformly from [0, 1) for an index */
+    double getUnitNumber(std::uint64_t index) const;
+
+    /*! @brief returns the index of the next draw */
+    std::uint64_t getPosition() const;
+
+    /*! @brief sets the index of the next draw, in O(1) */
+    void setPosition(std::uint64_t position);
+
+    /*! @brief returns the index of the next draw and moves on to the one
+     * after */
+    std::uint64_t takeIndex();
+
+  private:
+    std::uint64_t m_key;
+    std::uint64_t m_hashedKey;
+    std::uint64_t m_position;
+};
+} // namespace aleatoric
+
+#endif /* CounterEngine_hpp */
@@ -1,13 +1,280 @@
 #include "Engine.hpp"
 
-#include <random>
+#include "HashedSeedSource.hpp"
+#include "MultiLanePcg32.hpp"
+#include "OsEntropySource.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
 
 namespace aleatoric {
-Engine::Engine() : m_engine(pcg_extras::seed_seq_from<std::random_device>())
+namespace {
+#if !defined(ALEATORIC_ENGINE_PCG64) && !defined(ALEATORIC_ENGINE_PCG32_FAST)
+// pcg32 keeps its state protected. Naming the member through a derived class
+// gives a member pointer that can be applied to any pcg32.
+struct Pcg32StateAccess : pcg32 {
+    static std::uint64_t &getState(pcg32 &engine)
+    {
+        return engine.*(&Pcg32StateAccess::state_);
+    }
+};
+
+// The multi-lane kernel reproduces pcg32 only, so is compiled only when pcg32
+// is the engine type. The other engine types generate in bulk one output at a
+// time.
+void generateRaw(pcg32 &engine, std::uint32_t *output, std::size_t count)
+{
+    MultiLanePcg32::generate(Pcg32StateAccess::getState(engine),
+                             engine.increment(),
+                             output,
+                             count);
+}
+#endif
+
+template<typename EngineType>
+void generateRaw(EngineType &engine,
+                 typename EngineType::result_type *output,
+                 std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = engine();
+    }
+}
+
+template<typename EngineType>
+EngineType seedEngine(std::uint64_t seed,
+                      std::true_type /* canSpecifyStream */)
+{
+    return EngineType(seed);
+}
+
+// Engines without streams are mcgs, which discard the low two bits of the
+// seed. The seed is hashed first so that adjacent seeds still produce
+// different sequences.
+template<typename EngineType>
+EngineType seedEngine(std::uint64_t seed,
+                      std::false_type /* canSpecifyStream */)
+{
+    return EngineType(HashedSeedSource::hash(seed));
+}
+
+template<typename EngineType>
+EngineType seedStream(std::uint64_t seed,
+                      std::uint64_t streamId,
+                      std::true_type /* canSpecifyStream */)
+{
+    return EngineType(seed, streamId);
+}
+
+template<typename EngineType>
+EngineType seedStream(std::uint64_t seed,
+                      std::uint64_t streamId,
+                      std::false_type canSpecifyStream)
+{
+    auto engine = seedEngine<EngineType>(seed, canSpecifyStream);
+    engine.advance(streamId << 48);
+    return engine;
+}
+
+using CanSpecifyStream =
+    std::integral_constant<bool, Engine::EngineType::can_specify_stream>;
+
+std::shared_ptr<IEntropySource> &defaultEntropySource()
+{
+    static std::shared_ptr<IEntropySource> entropySource =
+        std::make_shared<OsEntropySource>();
+    return entropySource;
+}
+
+void checkEntropySource(const std::shared_ptr<IEntropySource> &entropySource)
+{
+    if(!entropySource) {
+        throw std::invalid_argument(
+            "The entropy source supplied must not be null");
+    }
+}
+} // namespace
+
+constexpr std::size_t Engine::bufferSize;
+constexpr std::size_t Engine::outputsPerUnitNumber;
+
+Engine::Engine() : Engine(getDefaultEntropySource())
+{}
+
+Engine::Engine(std::shared_ptr<IEntropySource> entropySource)
+: m_isSeeded(false), m_entropySource(std::move(entropySource))
+{
+    checkEntropySource(m_entropySource);
+}
+
+Engine::Engine(std::uint64_t seed)
+: m_engine(seedEngine<EngineType>(seed, CanSpecifyStream())), m_isSeeded(true)
 {}
 
-pcg32 &Engine::getEngine()
+Engine::Engine(std::uint64_t seed, std::uint64_t streamId)
+: m_engine(seedStream<EngineType>(seed, streamId, CanSpecifyStream())),
+  m_isSeeded(true)
+{}
+
+std::vector<std::shared_ptr<Engine>>
+Engine::createStreams(std::uint64_t seed, int count)
 {
+    if(count < 0) {
+        throw std::invalid_argument(
+            "The value passed as argument for count must not be negative");
+    }
+
+    std::vector<std::shared_ptr<Engine>> engines(count);
+
+    for(size_t i = 0; i < engines.size(); i++) {
+        engines[i] = std::make_shared<Engine>(seed, i);
+    }
+
+    return engines;
+}
+
+void Engine::setDefaultEntropySource(
+    std::shared_ptr<IEntropySource> entropySource)
+{
+    checkEntropySource(entropySource);
+
+    // NB: engines may be constructed on other threads while this is set
+    std::atomic_store(&defaultEntropySource(), std::move(entropySource));
+}
+
+std::shared_ptr<IEntropySource> Engine::getDefaultEntropySource()
+{
+    return std::atomic_load(&defaultEntropySource());
+}
+
+void Engine::advance(std::uint64_t delta)
+{
+    seedIfNeeded();
+    discardBuffer();
+    m_engine.advance(delta);
+}
+
+std::string Engine::saveState()
+{
+    seedIfNeeded();
+    discardBuffer();
+
+    std::ostringstream state;
+    state << m_engine;
+    return state.str();
+}
+
+void Engine::restoreState(const std::string &state)
+{
+    std::istringstream stateStream(state);
+    EngineType engine;
+    stateStream >> engine;
+
+    if(stateStream.fail()) {
+        throw std::invalid_argument(
+            "The state supplied was not saved by an engine of this type");
+    }
+
+    // the block (if any) was generated by the old state
+    discardBuffer();
+    m_engine = engine;
+    m_isSeeded = true;
+    m_entropySource.reset();
+}
+
+void Engine::setBuffered(bool buffered)
+{
+    discardBuffer();
+
+    if(buffered) {
+        m_buffer.resize(bufferSize);
+    } else {
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+    }
+
+    // mark the (possibly new) block as used up so the next draw refills it
+    m_bufferPosition = m_buffer.size();
+}
+
+bool Engine::isBuffered() const
+{
+    return !m_buffer.empty();
+}
+
+bool Engine::isSeeded() const
+{
+    return m_isSeeded;
+}
+
+void Engine::generate(result_type *output, std::size_t count)
+{
+    seedIfNeeded();
+    discardBuffer();
+    generateRaw(m_engine, output, count);
+}
+
+void Engine::generateUnitNumbers(double *output, std::size_t count)
+{
+    constexpr std::size_t blockSize = bufferSize / outputsPerUnitNumber;
+    result_type block[bufferSize];
+
+    for(std::size_t done = 0; done < count; done += blockSize) {
+        auto blockCount = std::min(blockSize, count - done);
+        generate(block, blockCount * outputsPerUnitNumber);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            std::uint64_t bits = block[i * outputsPerUnitNumber];
+            if(outputsPerUnitNumber == 2) {
+                bits = bits << 32 | block[i * outputsPerUnitNumber + 1];
+            }
+
+            output[done + i] = toUnitNumber(bits);
+        }
+    }
+}
+
+Engine::EngineType &Engine::getEngine()
+{
+    seedIfNeeded();
+    discardBuffer();
     return m_engine;
 }
+
+// Private methods
+Engine::result_type Engine::drawFromEngine()
+{
+    seedIfNeeded();
+    return m_buffer.empty() ? m_engine() : refillBuffer();
+}
+
+Engine::result_type Engine::refillBuffer()
+{
+    generateRaw(m_engine, m_buffer.data(), m_buffer.size());
+
+    m_bufferPosition = 1;
+    return m_buffer[0];
+}
+
+void Engine::discardBuffer()
+{
+    // step the engine back over the outputs generated but not yet used
+    m_engine.backstep(m_buffer.size() - m_bufferPosition);
+    m_bufferPosition = m_buffer.size();
+}
+
+void Engine::seedIfNeeded()
+{
+    if(!m_isSeeded) {
+        // NB: separate statements as the order of argument evaluation is
+        // unspecified
+        auto seed = m_entropySource->getSeed();
+        auto streamId = m_entropySource->getSeed();
+        m_engine = seedStream<EngineType>(seed, streamId, CanSpecifyStream());
+        m_isSeeded = true;
+        m_entropySource.reset();
+    }
+}
 } // namespace aleatoric
@@ -1,16 +1,275 @@
 #ifndef Engine_hpp
 #define Engine_hpp
 
+#include <cstdint>
+#include <memory>
 #include <pcg_random.hpp>
+#include <string>
+#include <vector>
 
 namespace aleatoric {
+class IEntropySource;
+
+/*!
+@brief Wraps the [Permuted Congruential Generator -
+PCG](https://github.com/imneme/pcg-cpp) engine from which all generators draw
+
+An Engine can be owned by a single generator or shared between several by
+passing a std::shared_ptr<Engine> to the generator constructors or to
+NumberProtocol::create. Sharing one engine across all the generators of a voice
+saves memory and seeding time. An engine is not thread safe, so generators that
+share one must be used from the same thread.
+
+Engine satisfies the UniformRandomBitGenerator requirements so it can be passed
+directly to the standard distributions.
+
+The pcg engine used is chosen at build time with the ALEATORIC_ENGINE cmake
+option: pcg32 (the default), pcg32_fast for throughput, or pcg64 for a longer
+period and 64 bit output.
+*/
 class Engine {
   public:
+#if defined(ALEATORIC_ENGINE_PCG64)
+    using EngineType = pcg64;
+#elif defined(ALEATORIC_ENGINE_PCG32_FAST)
+    using EngineType = pcg32_fast;
+#else
+    using EngineType = pcg32;
+#endif
+
+    using result_type = EngineType::result_type;
+
+    /*! @brief number of raw outputs generated per block in buffered mode */
+    static constexpr std::size_t bufferSize = 256;
+
+    /*! @brief number of raw outputs used by getUnitNumber */
+    static constexpr std::size_t outputsPerUnitNumber =
+        sizeof(result_type) < sizeof(std::uint64_t) ? 2 : 1;
+
+    /*!
+     * @brief Seeds the engine from the default entropy source (by default the
+     * OS, see OsEntropySource)
+     *
+     * Seeding is deferred until the engine is first used, so engines (and the
+     * generators holding them) that are constructed and configured but never
+     * drawn from do not pay for the entropy read.
+     */
     Engine();
-    pcg32 &getEngine();
+
+    /*! @brief Seeds the engine from the entropy source supplied, deferred as
+     * for Engine(). The source must not be null. */
+    explicit Engine(std::shared_ptr<IEntropySource> entropySource);
+
+    /*! @brief Seeds the engine deterministically. Two engines constructed with
+     * the same seed produce identical sequences */
+    explicit Engine(std::uint64_t seed);
+
+    /*!
+     * @brief Seeds the engine deterministically on a specific stream
+     *
+     * Engines sharing a seed but constructed with different stream ids produce
+     * statistically independent sequences. This allows work (e.g. a bank of
+     * voices) to be divided between threads while the output for each part
+     * depends only on the seed and its stream id, not on the number of
+     * threads.
+     *
+     * pcg32_fast has no streams, so for that engine a stream is instead the
+     * sequence for the seed jumped ahead by streamId * 2^48. Its period of
+     * 2^62 means stream ids repeat every 2^14.
+     *
+     * @param seed seed for the engine
+     * @param streamId id of the stream to select. Any value is valid.
+     */
+    Engine(std::uint64_t seed, std::uint64_t streamId);
+
+    /*!
+     * @brief Creates engines for streams 0 to count - 1 of the given seed
+     *
+     * The engine at index i is equivalent to Engine(seed, i).
+     */
+    static std::vector<std::shared_ptr<Engine>>
+    createStreams(std::uint64_t seed, int count);
+
+    /*!
+     * @brief Sets the entropy source for engines constructed without a seed
+     *
+     * Affects engines constructed afterwards, including the thread engines of
+     * the EngineRegistry. Set a HashedSeedSource to make them reproducible.
+     * The source must not be null.
+     */
+    static void
+    setDefaultEntropySource(std::shared_ptr<IEntropySource> entropySource);
+
+    static std::shared_ptr<IEntropySource> getDefaultEntropySource();
+
+    /*!
+     * @brief Jumps the engine ahead by delta raw outputs in O(log delta) time
+     *
+     * Equivalent to drawing delta numbers directly from getEngine(). Note that
+     * the generators do not necessarily consume exactly one raw output per
+     * number they return.
+     */
+    void advance(std::uint64_t delta);
+
+    /*!
+     * @brief Returns the full state of the engine as text
+     *
+     * The state can be passed to restoreState, on this or another engine, to
+     * return to the current point in the sequence. This allows a long render
+     * to be checkpointed and resumed without replaying its draws. See also
+     * NumberProtocol::saveState.
+     */
+    std::string saveState();
+
+    /*!
+     * @brief Returns the engine to a state returned by saveState
+     *
+     * Buffering is unaffected. Throws std::invalid_argument if the state was
+     * not saved by an engine of the same type.
+     */
+    void restoreState(const std::string &state);
+
+    /*!
+     * @brief Switches block buffering of raw outputs on or off
+     *
+     * When buffered, raw outputs are generated bufferSize at a time and
+     * served from the block, which amortises the engine work over bulk draws
+     * (e.g. producer collections). Buffering does not change the sequence
+     * produced. Engines from the EngineRegistry are buffered.
+     */
+    void setBuffered(bool buffered);
+
+    bool isBuffered() const;
+
+    /*! @brief returns false if the engine was constructed without a seed and
+     * has not yet been used */
+    bool isSeeded() const;
+
+    /*! @brief returns the next raw output */
+    result_type operator()();
+
+    /*!
+     * @brief Returns a number drawn uniformly from 0 to bound - 1
+     *
+     * Uses Lemire's nearly divisionless method: a 32 bit output is multiplied
+     * by the bound and the high half of the product taken, so most draws cost
+     * one multiply. The few outputs that would bias the result are rejected,
+     * which needs a division only when the low half of the product falls below
+     * the bound. A bound of 0 stands for 2^32, returning the full output.
+     */
+    std::uint32_t getBoundedNumber(std::uint32_t bound);
+
+    /*!
+     * @brief Returns a number drawn uniformly from [0, 1)
+     *
+     * 53 raw bits, enough to fill the significand of a double, are scaled by
+     * 2^-53. pcg32 engines use two outputs per number and pcg64 one.
+     */
+    double getUnitNumber();
+
+    /*!
+     * @brief Writes count numbers from [0, 1) to output
+     *
+     * Equivalent to calling getUnitNumber() count times, but the raw outputs
+     * are generated in bulk (see generate()).
+     */
+    void generateUnitNumbers(double *output, std::size_t count);
+
+    /*!
+     * @brief Writes the next count raw outputs to output
+     *
+     * Equivalent to calling operator() count times. For pcg32 the outputs are
+     * generated several at a time (see MultiLanePcg32). Used for bulk
+     * generation and for refilling the block in buffered mode.
+     */
+    void generate(result_type *output, std::size_t count);
+
+    static constexpr result_type min()
+    {
+        return EngineType::min();
+    }
+
+    static constexpr result_type max()
+    {
+        return EngineType::max();
+    }
+
+    /*! @brief returns the underlying pcg engine
+     *
+     * In buffered mode, the unused part of the current block is discarded
+     * first so that the engine is at the position of the next output. */
+    EngineType &getEngine();
 
   private:
-    pcg32 m_engine;
+    EngineType m_engine;
+    bool m_isSeeded;
+    std::shared_ptr<IEntropySource> m_entropySource;
+    std::vector<result_type> m_buffer;
+    std::size_t m_bufferPosition {0};
+    result_type drawFromEngine();
+    result_type refillBuffer();
+    void discardBuffer();
+    void seedIfNeeded();
+    static double toUnitNumber(std::uint64_t bits);
 };
+
+// NB: defined in the header so the common path (a number already in the block,
+// or a seeded unbuffered engine) can be inlined into the distributions
+inline Engine::result_type Engine::operator()()
+{
+    if(m_bufferPosition < m_buffer.size()) {
+        return m_buffer[m_bufferPosition++];
+    }
+
+    if(m_isSeeded && m_buffer.empty()) {
+        return m_engine();
+    }
+
+    return drawFromEngine();
+}
+
+inline std::uint32_t Engine::getBoundedNumber(std::uint32_t bound)
+{
+    // NB: pcg64 outputs are truncated to their low 32 bits
+    auto draw = [this]() {
+        auto output = static_cast<std::uint32_t>((*this)());
+        return static_cast<std::uint64_t>(output);
+    };
+
+    if(bound == 0) {
+        return static_cast<std::uint32_t>(draw());
+    }
+
+    auto product = draw() * bound;
+    auto low = static_cast<std::uint32_t>(product);
+
+    if(low < bound) {
+        // (2^32 - bound) % bound: the number of outputs to reject
+        std::uint32_t threshold = (0u - bound) % bound;
+
+        while(low < threshold) {
+            product = draw() * bound;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+inline double Engine::getUnitNumber()
+{
+    std::uint64_t bits = (*this)();
+    if(outputsPerUnitNumber == 2) {
+        bits = bits << 32 | (*this)();
+    }
+
+    return toUnitNumber(bits);
+}
+
+inline double Engine::toUnitNumber(std::uint64_t bits)
+{
+    // the top 53 bits times 2^-53
+    return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
 } // namespace aleatoric
 #endif /* Engine_hpp */
@@ -0,0 +1,19 @@
+#include "EngineRegistry.hpp"
+
+#include "Engine.hpp"
+
+namespace aleatoric {
+std::shared_ptr<Engine> EngineRegistry::getThreadEngine()
+{
+    // NB: generators hold a shared_ptr to the engine so it outlives the
+    // thread if they do
+    thread_local std::shared_ptr<Engine> engine;
+
+    if(!engine) {
+        engine = std::make_shared<Engine>();
+        engine->setBuffered(true);
+    }
+
+    return engine;
+}
+} // namespace aleatoric
@@ -0,0 +1,30 @@
+#ifndef EngineRegistry_hpp
+#define EngineRegistry_hpp
+
+#include <memory>
+
+namespace aleatoric {
+class Engine;
+
+/*!
+@brief Provides each thread with its own default Engine
+
+The engine for a thread is created the first time it is requested on that
+thread, and seeded from the default entropy source (see
+Engine::setDefaultEntropySource()) when first used. Every subsequent request on
+the same thread returns the same engine. Thread engines are buffered (see
+Engine::setBuffered()).
+
+Generators that are not given a seed or an engine draw from the engine of the
+thread on which they were constructed. Such generators must therefore be used
+on that thread, or handed to another thread only when the constructing thread
+no longer draws from its engine.
+*/
+class EngineRegistry {
+  public:
+    /*! @brief returns the engine for the calling thread */
+    static std::shared_ptr<Engine> getThreadEngine();
+};
+} // namespace aleatoric
+
+#endif /* EngineRegistry_hpp */
@@ -0,0 +1,21 @@
+#include "HashedSeedSource.hpp"
+
+namespace aleatoric {
+HashedSeedSource::HashedSeedSource(std::uint64_t masterSeed)
+: m_masterSeed(masterSeed), m_count(0)
+{}
+
+std::uint64_t HashedSeedSource::getSeed()
+{
+    // NB: the golden ratio increment of splitmix64
+    auto count = ++m_count;
+    return hash(m_masterSeed + count * 0x9e3779b97f4a7c15ULL);
+}
+
+std::uint64_t HashedSeedSource::hash(std::uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+} // namespace aleatoric
@@ -0,0 +1,37 @@
+#ifndef HashedSeedSource_hpp
+#define HashedSeedSource_hpp
+
+#include "IEntropySource.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+@brief Derives a sequence of seeds from a single master seed
+
+The nth seed returned is a hash (the splitmix64 finaliser) of the master seed
+and n, so the seeds are well spread even for adjacent master seeds, and the
+engines seeded from the source are reproducible given the master seed and the
+order in which they are seeded. Seeding never touches the OS.
+
+Set as the default entropy source (see Engine::setDefaultEntropySource), it
+makes every engine constructed without a seed reproducible.
+*/
+class HashedSeedSource : public IEntropySource {
+  public:
+    explicit HashedSeedSource(std::uint64_t masterSeed);
+
+    /*! @brief returns the next seed in the sequence for the master seed */
+    std::uint64_t getSeed() override;
+
+    /*! @brief the splitmix64 finaliser: a bijective hash of a 64 bit value */
+    static std::uint64_t hash(std::uint64_t value);
+
+  private:
+    const std::uint64_t m_masterSeed;
+    std::atomic<std::uint64_t> m_count;
+};
+} // namespace aleatoric
+
+#endif /* HashedSeedSource_hpp */
@@ -0,0 +1,22 @@
+// Interface
+#ifndef IEntropySource_hpp
+#define IEntropySource_hpp
+
+#include <cstdint>
+
+namespace aleatoric {
+/*! @brief An interface abstract class for the sources from which engines
+ * constructed without a seed are seeded (see Engine::setDefaultEntropySource)
+ *
+ * Implementations must be safe to call from several threads at once, as
+ * engines on different threads may be seeded from the same source. */
+class IEntropySource {
+  public:
+    /*! @brief pure virtual method for returning a seed. Each call should
+     * return a different seed. */
+    virtual std::uint64_t getSeed() = 0;
+    virtual ~IEntropySource() = default;
+};
+} // namespace aleatoric
+
+#endif /* IEntropySource_hpp */
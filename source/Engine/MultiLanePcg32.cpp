@@ -0,0 +1,151 @@
+#include "MultiLanePcg32.hpp"
+
+#if(defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define ALEATORIC_AVX2_LANES 1
+#include <immintrin.h>
+#endif
+
+namespace aleatoric {
+constexpr std::uint64_t MultiLanePcg32::multiplier;
+
+namespace {
+constexpr std::size_t laneCount = 8;
+
+inline std::uint32_t xshRrOutput(std::uint64_t state)
+{
+    auto xorshifted =
+        static_cast<std::uint32_t>(((state >> 18u) ^ state) >> 27u);
+    auto rotation = static_cast<std::uint32_t>(state >> 59u);
+    return (xorshifted >> rotation) | (xorshifted << ((-rotation) & 31u));
+}
+
+#ifdef ALEATORIC_AVX2_LANES
+// low 64 bits of a 64 x 64 bit product, from 32 x 32 bit multiplies
+__attribute__((target("avx2"))) inline __m256i multiply(__m256i a, __m256i b)
+{
+    auto lowProduct = _mm256_mul_epu32(a, b);
+    auto crossA = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+    auto crossB = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+    auto cross = _mm256_slli_epi64(_mm256_add_epi64(crossA, crossB), 32);
+    return _mm256_add_epi64(lowProduct, cross);
+}
+
+// XSH RR output for four 64 bit states, in the low half of each 64 bit lane
+__attribute__((target("avx2"))) inline __m256i xshRrOutput(__m256i state)
+{
+    auto lowMask = _mm256_set1_epi64x(0xffffffffULL);
+    auto xorshifted = _mm256_and_si256(
+        _mm256_srli_epi64(
+            _mm256_xor_si256(_mm256_srli_epi64(state, 18), state),
+            27),
+        lowMask);
+    auto rotation = _mm256_srli_epi64(state, 59);
+    auto right = _mm256_srlv_epi64(xorshifted, rotation);
+    auto left = _mm256_sllv_epi64(
+        xorshifted,
+        _mm256_sub_epi64(_mm256_set1_epi64x(32), rotation));
+    return _mm256_and_si256(_mm256_or_si256(right, left), lowMask);
+}
+
+__attribute__((target("avx2"))) void generateAvx2(std::uint64_t &state,
+                                                  std::uint64_t increment,
+                                                  std::uint32_t *output,
+                                                  std::size_t count)
+{
+    // lane k holds the state k steps ahead
+    alignas(32) std::uint64_t laneStates[laneCount];
+    laneStates[0] = state;
+    for(std::size_t i = 1; i < laneCount; i++) {
+        laneStates[i] =
+            laneStates[i - 1] * MultiLanePcg32::multiplier + increment;
+    }
+
+    // constants that step a state 8 positions at once
+    std::uint64_t laneMultiplier = 1;
+    std::uint64_t laneIncrement = 0;
+    for(std::size_t i = 0; i < laneCount; i++) {
+        laneMultiplier *= MultiLanePcg32::multiplier;
+        laneIncrement = laneIncrement * MultiLanePcg32::multiplier + increment;
+    }
+
+    auto lowLanes =
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(laneStates));
+    auto highLanes =
+        _mm256_load_si256(reinterpret_cast<const __m256i *>(laneStates + 4));
+    auto stepMultiplier =
+        _mm256_set1_epi64x(static_cast<long long>(laneMultiplier));
+    auto stepIncrement =
+        _mm256_set1_epi64x(static_cast<long long>(laneIncrement));
+    // gathers the low 32 bits of each 64 bit lane into the low 128 bits
+    auto packLowHalves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    std::size_t blocks = count / laneCount;
+    for(std::size_t i = 0; i < blocks; i++) {
+        auto lowOutput = _mm256_permutevar8x32_epi32(xshRrOutput(lowLanes),
+                                                     packLowHalves);
+        auto highOutput = _mm256_permutevar8x32_epi32(xshRrOutput(highLanes),
+                                                      packLowHalves);
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(output + i * laneCount),
+            _mm256_permute2x128_si256(lowOutput, highOutput, 0x20));
+
+        lowLanes = _mm256_add_epi64(multiply(lowLanes, stepMultiplier),
+                                    stepIncrement);
+        highLanes = _mm256_add_epi64(multiply(highLanes, stepMultiplier),
+                                     stepIncrement);
+    }
+
+    // lane 0 now holds the state following the last block
+    _mm256_store_si256(reinterpret_cast<__m256i *>(laneStates), lowLanes);
+    state = laneStates[0];
+
+    MultiLanePcg32::generateScalar(state,
+                                   increment,
+                                   output + blocks * laneCount,
+                                   count - blocks * laneCount);
+}
+#endif
+
+bool cpuSupportsAvx2()
+{
+#ifdef ALEATORIC_AVX2_LANES
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+} // namespace
+
+void MultiLanePcg32::generate(std::uint64_t &state,
+                              std::uint64_t increment,
+                              std::uint32_t *output,
+                              std::size_t count)
+{
+#ifdef ALEATORIC_AVX2_LANES
+    if(usesSimd()) {
+        generateAvx2(state, increment, output, count);
+        return;
+    }
+#endif
+    generateScalar(state, increment, output, count);
+}
+
+void MultiLanePcg32::generateScalar(std::uint64_t &state,
+                                    std::uint64_t increment,
+                                    std::uint32_t *output,
+                                    std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = xshRrOutput(state);
+        state = state * multiplier + increment;
+    }
+}
+
+bool MultiLanePcg32::usesSimd()
+{
+    static const bool supported = cpuSupportsAvx2();
+    return supported;
+}
+} // namespace aleatoric
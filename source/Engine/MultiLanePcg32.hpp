@@ -0,0 +1,47 @@
+#ifndef MultiLanePcg32_hpp
+#define MultiLanePcg32_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+@brief Generates blocks of pcg32 (XSH RR 64/32) output several states at a time
+
+The sequence is split across 8 lanes: lane k starts k steps ahead of the
+supplied state and every lane then steps 8 positions at a time. Interleaving
+the lanes therefore reproduces the scalar pcg32 sequence exactly, so the output
+does not depend on which implementation is used.
+
+An AVX2 implementation is selected at runtime when the CPU supports it. A
+scalar implementation is used otherwise.
+*/
+class MultiLanePcg32 {
+  public:
+    /*!
+     * @brief Writes the next count outputs of the sequence to output
+     *
+     * @param state pcg32 state. Updated to the state following the last output
+     * @param increment pcg32 increment (stream)
+     * @param output destination for count outputs
+     * @param count number of outputs to generate
+     */
+    static void generate(std::uint64_t &state,
+                         std::uint64_t increment,
+                         std::uint32_t *output,
+                         std::size_t count);
+
+    /*! @brief scalar implementation of generate(), used as the fallback */
+    static void generateScalar(std::uint64_t &state,
+                               std::uint64_t increment,
+                               std::uint32_t *output,
+                               std::size_t count);
+
+    /*! @brief returns whether generate() uses the AVX2 implementation */
+    static bool usesSimd();
+
+    static constexpr std::uint64_t multiplier = 6364136223846793005ULL;
+};
+} // namespace aleatoric
+
+#endif /* MultiLanePcg32_hpp */
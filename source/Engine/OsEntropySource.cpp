@@ -0,0 +1,59 @@
+#include "OsEntropySource.hpp"
+
+#include "HashedSeedSource.hpp"
+
+#include <atomic>
+#include <chrono>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <stdlib.h>
+#else
+#include <random>
+#endif
+
+namespace aleatoric {
+namespace {
+bool readOsEntropy(std::uint64_t &seed)
+{
+#if defined(__linux__) && defined(SYS_getrandom)
+    // NB: 1 is GRND_NONBLOCK, defined here as older C libraries lack the
+    // getrandom wrapper and its header
+    return syscall(SYS_getrandom, &seed, sizeof(seed), 1) ==
+           static_cast<long>(sizeof(seed));
+#elif defined(__linux__)
+    static_cast<void>(seed);
+    return false;
+#elif defined(__APPLE__)
+    arc4random_buf(&seed, sizeof(seed));
+    return true;
+#else
+    std::random_device device;
+    seed = static_cast<std::uint64_t>(device()) << 32 | device();
+    return true;
+#endif
+}
+
+std::uint64_t getFallbackSeed()
+{
+    static std::atomic<std::uint64_t> count(0);
+    int local;
+
+    auto time = static_cast<std::uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    auto address = static_cast<std::uint64_t>(
+        reinterpret_cast<std::uintptr_t>(&local));
+
+    return HashedSeedSource::hash(
+        HashedSeedSource::hash(time ^ address) + ++count);
+}
+} // namespace
+
+std::uint64_t OsEntropySource::getSeed()
+{
+    std::uint64_t seed;
+    return readOsEntropy(seed) ? seed : getFallbackSeed();
+}
+} // namespace aleatoric
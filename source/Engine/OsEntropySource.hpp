@@ -0,0 +1,26 @@
+#ifndef OsEntropySource_hpp
+#define OsEntropySource_hpp
+
+#include "IEntropySource.hpp"
+
+#include <cstdint>
+
+namespace aleatoric {
+/*!
+@brief Reads seeds from the OS without blocking
+
+On Linux seeds come from getrandom() with GRND_NONBLOCK, on Apple platforms from
+arc4random_buf() and elsewhere from std::random_device. If the OS cannot supply
+entropy immediately (e.g. a container whose entropy pool is not yet
+initialised), the seed is instead hashed from the clock, an address and a
+counter, so seeding never waits on the kernel.
+
+This is the default entropy source (see Engine::setDefaultEntropySource).
+*/
+class OsEntropySource : public IEntropySource {
+  public:
+    std::uint64_t getSeed() override;
+};
+} // namespace aleatoric
+
+#endif /* OsEntropySource_hpp */
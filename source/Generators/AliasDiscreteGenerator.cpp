@@ -0,0 +1,224 @@
+#include "AliasDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+AliasDiscreteGenerator::AliasDiscreteGenerator()
+: AliasDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+AliasDiscreteGenerator::AliasDiscreteGenerator(std::vector<double> distribution)
+: AliasDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+AliasDiscreteGenerator::AliasDiscreteGenerator(std::vector<double> distribution,
+                                               std::uint64_t seed)
+: AliasDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+AliasDiscreteGenerator::AliasDiscreteGenerator(std::shared_ptr<Engine> engine)
+: AliasDiscreteGenerator(std::vector<double> {1.0, 1.0}, std::move(engine))
+{}
+
+AliasDiscreteGenerator::AliasDiscreteGenerator(std::vector<double> distribution,
+                                               std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)), m_distributionVector(distribution)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setAliasTable();
+}
+
+AliasDiscreteGenerator::~AliasDiscreteGenerator()
+{}
+
+int AliasDiscreteGenerator::getNumber()
+{
+    if(m_table->probabilities.empty()) {
+        return 0;
+    }
+
+    return selectIndex(m_engine->getUnitNumber());
+}
+
+void AliasDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    if(m_table->probabilities.empty()) {
+        std::fill(output, output + count, 0);
+        return;
+    }
+
+    double unitNumbers[Engine::bufferSize];
+
+    for(std::size_t done = 0; done < count; done += Engine::bufferSize) {
+        auto blockCount = std::min(Engine::bufferSize, count - done);
+        m_engine->generateUnitNumbers(unitNumbers, blockCount);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            output[done + i] = selectIndex(unitNumbers[i]);
+        }
+    }
+}
+
+void AliasDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    m_distributionVector = distributionVector;
+    setAliasTable();
+}
+
+void AliasDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                   double uniformValue)
+{
+    m_distributionVector.assign(vectorSize, uniformValue);
+    setAliasTable();
+}
+
+void AliasDiscreteGenerator::updateDistributionVector(int index,
+                                                      double newValue)
+{
+    m_distributionVector[index] = newValue;
+    setAliasTable();
+}
+
+void AliasDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    for(auto &&i : m_distributionVector) {
+        i = uniformValue;
+    }
+    setAliasTable();
+}
+
+void AliasDiscreteGenerator::beginDistributionUpdate()
+{
+    m_updateDepth++;
+}
+
+void AliasDiscreteGenerator::commitDistributionUpdate()
+{
+    if(m_updateDepth > 0) {
+        m_updateDepth--;
+    }
+    setAliasTable();
+}
+
+std::vector<double> AliasDiscreteGenerator::getDistributionVector()
+{
+    return m_distributionVector;
+}
+
+const std::vector<double> &AliasDiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+void AliasDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->advance(count * Engine::outputsPerUnitNumber);
+}
+
+void AliasDiscreteGenerator::setTableCacheCapacity(std::size_t capacity)
+{
+    m_tableCache.setCapacity(capacity);
+}
+
+std::size_t AliasDiscreteGenerator::getTableCacheSize() const
+{
+    return m_tableCache.size();
+}
+
+// Private methods
+void AliasDiscreteGenerator::setAliasTable()
+{
+    if(m_updateDepth > 0) {
+        return;
+    }
+
+    if(m_tableCache.getCapacity() > 0) {
+        m_table = m_tableCache.getTable(m_distributionVector, [this]() {
+            auto table = std::make_shared<AliasTable>();
+            buildAliasTable(*table);
+            return table;
+        });
+        return;
+    }
+
+    // NB: a table shared with the cache must not be changed
+    if(!m_table || m_table.use_count() > 1) {
+        m_table = std::make_shared<AliasTable>();
+    }
+    buildAliasTable(*m_table);
+}
+
+void AliasDiscreteGenerator::buildAliasTable(AliasTable &table) const
+{
+    auto size = m_distributionVector.size();
+    auto &probabilities = table.probabilities;
+    auto &aliases = table.aliases;
+    probabilities.assign(size, 1.0);
+    aliases.resize(size);
+
+    double total = 0.0;
+    for(auto &&weight : m_distributionVector) {
+        total += weight;
+    }
+
+    // each column starts as its own alias, which leaves a uniform table when
+    // every weight is zero
+    for(size_t i = 0; i < size; i++) {
+        aliases[i] = static_cast<int>(i);
+    }
+
+    if(total <= 0.0) {
+        return;
+    }
+
+    // weights scaled so that their mean is 1. Columns below 1 (small) are
+    // topped up by an alias from those above 1 (large).
+    std::vector<double> scaled(size);
+    std::vector<int> small;
+    std::vector<int> large;
+
+    for(size_t i = 0; i < size; i++) {
+        scaled[i] = m_distributionVector[i] * size / total;
+        scaled[i] < 1.0 ? small.push_back(static_cast<int>(i))
+                        : large.push_back(static_cast<int>(i));
+    }
+
+    while(!small.empty() && !large.empty()) {
+        auto smallIndex = small.back();
+        auto largeIndex = large.back();
+        small.pop_back();
+
+        probabilities[smallIndex] = scaled[smallIndex];
+        aliases[smallIndex] = largeIndex;
+
+        scaled[largeIndex] = (scaled[largeIndex] + scaled[smallIndex]) - 1.0;
+        if(scaled[largeIndex] < 1.0) {
+            large.pop_back();
+            small.push_back(largeIndex);
+        }
+    }
+
+    // NB: whatever is left is within rounding error of 1 and keeps the
+    // probability of 1 it was given above
+}
+
+int AliasDiscreteGenerator::selectIndex(double unitNumber) const
+{
+    // NB: a unit number below 1 scaled by the size stays below the size
+    const auto &table = *m_table;
+    auto scaled = unitNumber * table.probabilities.size();
+    auto column = static_cast<int>(scaled);
+
+    return scaled - column < table.probabilities[column]
+               ? column
+               : table.aliases[column];
+}
+} // namespace aleatoric
@@ -0,0 +1,111 @@
+#ifndef AliasDiscreteGenerator_hpp
+#define AliasDiscreteGenerator_hpp
+
+#include "DistributionTableCache.hpp"
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution in constant time with an
+alias table
+
+Each index of the distribution is given a column holding a probability of
+returning the index itself and an alias to return otherwise (Vose's alias
+method). A number then takes one unit number from the engine, whose integer
+part (scaled by the size of the distribution) selects a column and whose
+fractional part is compared with the column's probability. DiscreteGenerator
+instead searches the cumulative weights, which costs O(log n) per number.
+
+Building the table is O(n), so this generator suits distributions whose
+weights are set once and then sampled many times, e.g. the tables of
+Precision. Every change to the distribution vector rebuilds the table, unless
+the table for the new vector is held in the cache (see setTableCacheCapacity).
+If every weight is zero, every index is equally likely.
+*/
+class AliasDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    AliasDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit AliasDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    AliasDiscreteGenerator(std::vector<double> distribution,
+                           std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit AliasDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    AliasDiscreteGenerator(std::vector<double> distribution,
+                           std::shared_ptr<Engine> engine);
+
+    ~AliasDiscreteGenerator();
+
+    int getNumber() override;
+
+    /*! @brief writes count numbers to output, generating the unit numbers
+     * they take a block at a time */
+    void getNumbers(int *output, std::size_t count) override;
+
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    void updateDistributionVector(int index, double newValue) override;
+
+    void updateDistributionVector(double uniformValue) override;
+
+    /*! @brief defers rebuilding the distribution until
+     * commitDistributionUpdate() */
+    void beginDistributionUpdate() override;
+
+    void commitDistributionUpdate() override;
+
+    std::vector<double> getDistributionVector() override;
+
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief skips the next count numbers by advancing the engine, as each
+     * number takes one unit number */
+    void discard(std::uint64_t count) override;
+
+    /*! @brief keeps the tables built for up to capacity distinct distribution
+     * vectors, so that returning to one reuses its table. Zero (the default)
+     * disables the cache. */
+    void setTableCacheCapacity(std::size_t capacity);
+
+    /*! @brief returns the number of tables held in the cache */
+    std::size_t getTableCacheSize() const;
+
+  private:
+    struct AliasTable {
+        std::vector<double> probabilities;
+        std::vector<int> aliases;
+    };
+
+    std::shared_ptr<Engine> m_engine;
+    std::vector<double> m_distributionVector;
+    std::shared_ptr<AliasTable> m_table;
+    DistributionTableCache<AliasTable> m_tableCache;
+    int m_updateDepth = 0;
+    void setAliasTable();
+    void buildAliasTable(AliasTable &table) const;
+    int selectIndex(double unitNumber) const;
+};
+} // namespace aleatoric
+
+#endif /* AliasDiscreteGenerator_hpp */
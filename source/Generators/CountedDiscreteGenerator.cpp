@@ -0,0 +1,229 @@
+#include "CountedDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace aleatoric {
+namespace {
+std::uint64_t toCount(double weight)
+{
+    // NB: whole numbers from 2^53 are not all representable as doubles
+    if(!(weight >= 0.0 && weight < 9007199254740992.0) ||
+       std::floor(weight) != weight) {
+        throw std::invalid_argument(
+            "The weights of a CountedDiscreteGenerator must be whole numbers "
+            "of zero or more");
+    }
+
+    return static_cast<std::uint64_t>(weight);
+}
+
+// The high 64 bits of a * b, i.e. a scaled by b / 2^64, from four 32 bit
+// products so as not to need a 128 bit type
+std::uint64_t multiplyHigh(std::uint64_t a, std::uint64_t b)
+{
+    std::uint64_t aLow = a & 0xffffffffu;
+    std::uint64_t aHigh = a >> 32;
+    std::uint64_t bLow = b & 0xffffffffu;
+    std::uint64_t bHigh = b >> 32;
+
+    auto lowLow = aLow * bLow;
+    auto highLow = aHigh * bLow;
+    auto lowHigh = aLow * bHigh;
+    auto highHigh = aHigh * bHigh;
+
+    auto middle = (lowLow >> 32) + (highLow & 0xffffffffu) + lowHigh;
+    return highHigh + (highLow >> 32) + (middle >> 32);
+}
+} // namespace
+
+CountedDiscreteGenerator::CountedDiscreteGenerator()
+: CountedDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+CountedDiscreteGenerator::CountedDiscreteGenerator(
+    std::vector<double> distribution)
+: CountedDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+CountedDiscreteGenerator::CountedDiscreteGenerator(
+    std::vector<double> distribution,
+    std::uint64_t seed)
+: CountedDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+CountedDiscreteGenerator::CountedDiscreteGenerator(
+    std::shared_ptr<Engine> engine)
+: CountedDiscreteGenerator(std::vector<double> {1.0, 1.0}, std::move(engine))
+{}
+
+CountedDiscreteGenerator::CountedDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine))
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setDistributionVector(distribution);
+}
+
+CountedDiscreteGenerator::~CountedDiscreteGenerator()
+{}
+
+int CountedDiscreteGenerator::getNumber()
+{
+    auto size = m_distributionVector.size();
+    if(size == 0) {
+        return 0;
+    }
+
+    auto bits = getRandomBits();
+
+    if(m_total == 0) {
+        return static_cast<int>(multiplyHigh(bits, size));
+    }
+
+    // Find the number of leading counts whose sum does not exceed the
+    // target: that is the index selected. The target is below the total and
+    // the sums are exact, so the index selected always has a count above
+    // zero.
+    auto remaining = multiplyHigh(bits, m_total);
+    std::size_t position = 0;
+
+    for(auto step = m_topStep; step > 0; step >>= 1) {
+        auto next = position + step;
+        if(next <= size && m_tree[next] <= remaining) {
+            position = next;
+            remaining -= m_tree[next];
+        }
+    }
+
+    return static_cast<int>(position);
+}
+
+void CountedDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = CountedDiscreteGenerator::getNumber();
+    }
+}
+
+void CountedDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    for(auto &&weight : distributionVector) {
+        toCount(weight);
+    }
+
+    m_distributionVector = distributionVector;
+    buildTree();
+}
+
+void CountedDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                     double uniformValue)
+{
+    toCount(uniformValue);
+    m_distributionVector.assign(vectorSize, uniformValue);
+    buildTree();
+}
+
+void CountedDiscreteGenerator::updateDistributionVector(int index,
+                                                        double newValue)
+{
+    auto newCount = toCount(newValue);
+    auto oldCount = static_cast<std::uint64_t>(m_distributionVector[index]);
+    m_distributionVector[index] = newValue;
+
+    // NB: unsigned arithmetic wraps, so adding the difference as an unsigned
+    // number also works when the count goes down
+    auto difference = newCount - oldCount;
+    for(std::size_t node = index + 1; node < m_tree.size();
+        node += node & (~node + 1)) {
+        m_tree[node] += difference;
+    }
+    m_total += difference;
+
+    if(oldCount == 0 && newCount > 0) {
+        m_supportSize++;
+    } else if(oldCount > 0 && newCount == 0) {
+        m_supportSize--;
+    }
+}
+
+void CountedDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    toCount(uniformValue);
+    for(auto &&i : m_distributionVector) {
+        i = uniformValue;
+    }
+    buildTree();
+}
+
+std::vector<double> CountedDiscreteGenerator::getDistributionVector()
+{
+    return m_distributionVector;
+}
+
+const std::vector<double> &CountedDiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+std::size_t CountedDiscreteGenerator::getSupportSize()
+{
+    return m_supportSize;
+}
+
+void CountedDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->advance(count * Engine::outputsPerUnitNumber);
+}
+
+// Private methods
+void CountedDiscreteGenerator::buildTree()
+{
+    auto size = m_distributionVector.size();
+    m_tree.assign(size + 1, 0);
+    m_supportSize = 0;
+
+    // each node adds its sum to the one node above it
+    for(std::size_t node = 1; node <= size; node++) {
+        auto count = static_cast<std::uint64_t>(m_distributionVector[node - 1]);
+        if(count > 0) {
+            m_supportSize++;
+        }
+
+        m_tree[node] += count;
+        auto parent = node + (node & (~node + 1));
+        if(parent <= size) {
+            m_tree[parent] += m_tree[node];
+        }
+    }
+
+    m_topStep = 1;
+    while(m_topStep * 2 <= size) {
+        m_topStep *= 2;
+    }
+
+    m_total = 0;
+    for(auto node = size; node > 0; node -= node & (~node + 1)) {
+        m_total += m_tree[node];
+    }
+}
+
+std::uint64_t CountedDiscreteGenerator::getRandomBits()
+{
+    // NB: the same outputs as a unit number takes, so that discarding can
+    // advance the engine in the same way
+    std::uint64_t bits = (*m_engine)();
+    if(Engine::outputsPerUnitNumber == 2) {
+        bits = bits << 32 | static_cast<std::uint32_t>((*m_engine)());
+    }
+    return bits;
+}
+} // namespace aleatoric
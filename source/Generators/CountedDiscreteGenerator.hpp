@@ -0,0 +1,93 @@
+#ifndef CountedDiscreteGenerator_hpp
+#define CountedDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution of whole number counts
+
+Each weight is the count of an index, e.g. the number of times it is still to
+be returned in a series. The counts are held in a Fenwick tree of integers, so
+a number is selected and a single count updated in O(log n) time, where n is
+the number of counts rather than their sum. A number takes 64 raw bits from
+the engine, which are scaled to the total count with integer arithmetic, so
+the counts are sampled exactly (to within a bias of total / 2^64) however
+large they are.
+
+Weights must be whole numbers of zero or more, below 2^53. If every weight is
+zero, every index is equally likely.
+*/
+class CountedDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    CountedDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit CountedDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    CountedDiscreteGenerator(std::vector<double> distribution,
+                             std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit CountedDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    CountedDiscreteGenerator(std::vector<double> distribution,
+                             std::shared_ptr<Engine> engine);
+
+    ~CountedDiscreteGenerator();
+
+    int getNumber() override;
+
+    void getNumbers(int *output, std::size_t count) override;
+
+    /*! @brief sets the distribution. Throws std::invalid_argument if a weight
+     * is not a whole number of zero or more. */
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    /*! @brief updates a single count in O(log n) time */
+    void updateDistributionVector(int index, double newValue) override;
+
+    void updateDistributionVector(double uniformValue) override;
+
+    std::vector<double> getDistributionVector() override;
+
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief returns the number of counts above zero, in constant time */
+    std::size_t getSupportSize() override;
+
+    /*! @brief skips the next count numbers by advancing the engine, as each
+     * number takes 64 raw bits */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<Engine> m_engine;
+    std::vector<double> m_distributionVector;
+    // NB: 1 based, so that node i covers the (i & -i) counts ending at i
+    std::vector<std::uint64_t> m_tree;
+    std::size_t m_topStep;
+    std::uint64_t m_total;
+    std::size_t m_supportSize;
+    void buildTree();
+    std::uint64_t getRandomBits();
+};
+} // namespace aleatoric
+
+#endif /* CountedDiscreteGenerator_hpp */
@@ -0,0 +1,132 @@
+#include "CounterDiscreteGenerator.hpp"
+
+#include "CounterEngine.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+CounterDiscreteGenerator::CounterDiscreteGenerator(
+    std::shared_ptr<CounterEngine> engine)
+: CounterDiscreteGenerator(std::vector<double> {1.0}, std::move(engine))
+{}
+
+CounterDiscreteGenerator::CounterDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<CounterEngine> engine)
+: m_engine(std::move(engine)), m_distributionVector(distribution)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setCumulativeWeights();
+}
+
+CounterDiscreteGenerator::~CounterDiscreteGenerator()
+{}
+
+int CounterDiscreteGenerator::getNumber()
+{
+    auto unitNumber = m_engine->getUnitNumber(m_engine->takeIndex());
+    auto total = m_cumulativeWeights.empty() ? 0.0 : m_cumulativeWeights.back();
+
+    if(total <= 0.0) {
+        return static_cast<int>(unitNumber * m_distributionVector.size());
+    }
+
+    auto selected = std::upper_bound(m_cumulativeWeights.begin(),
+                                     m_cumulativeWeights.end(),
+                                     unitNumber * total);
+
+    // NB: rounding can put the target at the very top of the total, in which
+    // case the last non-zero weight is selected
+    if(selected == m_cumulativeWeights.end()) {
+        selected = std::lower_bound(m_cumulativeWeights.begin(),
+                                    m_cumulativeWeights.end(),
+                                    total);
+    }
+
+    return static_cast<int>(selected - m_cumulativeWeights.begin());
+}
+
+void CounterDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = CounterDiscreteGenerator::getNumber();
+    }
+}
+
+void CounterDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    m_distributionVector = distributionVector;
+    setCumulativeWeights();
+}
+
+void CounterDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                     double uniformValue)
+{
+    m_distributionVector.assign(vectorSize, uniformValue);
+    setCumulativeWeights();
+}
+
+void CounterDiscreteGenerator::updateDistributionVector(int index,
+                                                        double newValue)
+{
+    m_distributionVector[index] = newValue;
+    setCumulativeWeights();
+}
+
+void CounterDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    for(auto &&i : m_distributionVector) {
+        i = uniformValue;
+    }
+    setCumulativeWeights();
+}
+
+void CounterDiscreteGenerator::beginDistributionUpdate()
+{
+    m_updateDepth++;
+}
+
+void CounterDiscreteGenerator::commitDistributionUpdate()
+{
+    if(m_updateDepth > 0) {
+        m_updateDepth--;
+    }
+    setCumulativeWeights();
+}
+
+std::vector<double> CounterDiscreteGenerator::getDistributionVector()
+{
+    return m_distributionVector;
+}
+
+const std::vector<double> &CounterDiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+void CounterDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->setPosition(m_engine->getPosition() + count);
+}
+
+// Private methods
+void CounterDiscreteGenerator::setCumulativeWeights()
+{
+    if(m_updateDepth > 0) {
+        return;
+    }
+
+    m_cumulativeWeights.resize(m_distributionVector.size());
+
+    double total = 0.0;
+    for(size_t i = 0; i < m_distributionVector.size(); i++) {
+        total += m_distributionVector[i];
+        m_cumulativeWeights[i] = total;
+    }
+}
+} // namespace aleatoric
@@ -0,0 +1,70 @@
+#ifndef CounterDiscreteGenerator_hpp
+#define CounterDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class CounterEngine;
+/*!
+@brief Counter based equivalent of DiscreteGenerator
+
+Each number is selected with the value of a CounterEngine at the engine's
+current position, which then moves on by one, so setting the position of the
+engine gives direct access to any number in the sequence (see
+CounterUniformGenerator).
+
+Selection is by a binary search of the cumulative weights. If every weight is
+zero, every index is equally likely.
+*/
+class CounterDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0} (always
+     * returns 0). The engine must not be null. */
+    explicit CounterDiscreteGenerator(std::shared_ptr<CounterEngine> engine);
+
+    /*! @brief Creates a generator with the distribution given. The engine
+     * must not be null. */
+    CounterDiscreteGenerator(std::vector<double> distribution,
+                             std::shared_ptr<CounterEngine> engine);
+
+    ~CounterDiscreteGenerator();
+
+    int getNumber() override;
+
+    void getNumbers(int *output, std::size_t count) override;
+
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    void updateDistributionVector(int index, double newValue) override;
+
+    void updateDistributionVector(double uniformValue) override;
+
+    /*! @brief defers rebuilding the distribution until
+     * commitDistributionUpdate() */
+    void beginDistributionUpdate() override;
+
+    void commitDistributionUpdate() override;
+
+    std::vector<double> getDistributionVector() override;
+
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief moves the engine position on by count */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<CounterEngine> m_engine;
+    std::vector<double> m_distributionVector;
+    std::vector<double> m_cumulativeWeights;
+    int m_updateDepth = 0;
+    void setCumulativeWeights();
+};
+} // namespace aleatoric
+
+#endif /* CounterDiscreteGenerator_hpp */
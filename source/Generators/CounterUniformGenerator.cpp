@@ -0,0 +1,62 @@
+#include "CounterUniformGenerator.hpp"
+
+#include "CounterEngine.hpp"
+
+#include <stdexcept>
+
+namespace aleatoric {
+CounterUniformGenerator::CounterUniformGenerator(
+    std::shared_ptr<CounterEngine> engine)
+: CounterUniformGenerator(0, 1, std::move(engine))
+{}
+
+CounterUniformGenerator::CounterUniformGenerator(
+    int rangeStart,
+    int rangeEnd,
+    std::shared_ptr<CounterEngine> engine)
+: m_engine(std::move(engine)), m_rangeStart(rangeStart), m_rangeEnd(rangeEnd)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+}
+
+CounterUniformGenerator::~CounterUniformGenerator()
+{}
+
+int CounterUniformGenerator::getNumber()
+{
+    return getNumber(m_rangeStart, m_rangeEnd);
+}
+
+int CounterUniformGenerator::getNumber(int rangeStart, int rangeEnd)
+{
+    // NB: a range covering every int has 2^32 values, which wraps to 0: the
+    // bound CounterEngine::getBoundedNumber takes to mean 2^32
+    auto rangeSize = static_cast<std::uint32_t>(rangeEnd) -
+                     static_cast<std::uint32_t>(rangeStart) + 1u;
+    auto offset =
+        m_engine->getBoundedNumber(m_engine->takeIndex(), rangeSize);
+
+    return static_cast<int>(static_cast<std::int64_t>(rangeStart) + offset);
+}
+
+void CounterUniformGenerator::getNumbers(int *output, std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] =
+            CounterUniformGenerator::getNumber(m_rangeStart, m_rangeEnd);
+    }
+}
+
+void CounterUniformGenerator::setDistribution(int rangeStart, int rangeEnd)
+{
+    m_rangeStart = rangeStart;
+    m_rangeEnd = rangeEnd;
+}
+
+void CounterUniformGenerator::discard(std::uint64_t count)
+{
+    m_engine->setPosition(m_engine->getPosition() + count);
+}
+} // namespace aleatoric
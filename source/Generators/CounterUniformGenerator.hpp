@@ -0,0 +1,53 @@
+#ifndef CounterUniformGenerator_hpp
+#define CounterUniformGenerator_hpp
+
+#include "IUniformGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace aleatoric {
+class CounterEngine;
+/*!
+@brief Counter based equivalent of UniformGenerator
+
+Each number is drawn from the value of a CounterEngine at the engine's current
+position, which then moves on by one. Setting the position of the engine
+therefore gives direct access to any number in the sequence: after
+setPosition(n), the next number returned is the one that would have been
+returned by the nth call to getNumber() (with the same range).
+*/
+class CounterUniformGenerator : public IUniformGenerator {
+  public:
+    /*! @brief Creates a generator with a range of 0 to 1. The engine must not
+     * be null. */
+    explicit CounterUniformGenerator(std::shared_ptr<CounterEngine> engine);
+
+    /*! @brief Creates a generator with the (inclusive) range given. The engine
+     * must not be null. */
+    CounterUniformGenerator(int rangeStart,
+                            int rangeEnd,
+                            std::shared_ptr<CounterEngine> engine);
+
+    ~CounterUniformGenerator();
+
+    int getNumber() override;
+
+    int getNumber(int rangeStart, int rangeEnd) override;
+
+    void getNumbers(int *output, std::size_t count) override;
+
+    void setDistribution(int rangeStart, int rangeEnd) override;
+
+    /*! @brief moves the engine position on by count */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<CounterEngine> m_engine;
+    int m_rangeStart;
+    int m_rangeEnd;
+};
+} // namespace aleatoric
+
+#endif /* CounterUniformGenerator_hpp */
@@ -1,22 +1,56 @@
 #include "DiscreteGenerator.hpp"
 
 #include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <stdexcept>
 
 namespace aleatoric {
-DiscreteGenerator::DiscreteGenerator() : m_engine(std::make_unique<Engine>())
-{
-    setDistributionVector(std::vector<double> {1.0, 1.0});
-}
+DiscreteGenerator::DiscreteGenerator()
+: DiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
 
 DiscreteGenerator::DiscreteGenerator(std::vector<double> distributionVector)
-: m_engine(std::make_unique<Engine>())
+: DiscreteGenerator(distributionVector, EngineRegistry::getThreadEngine())
+{}
+
+DiscreteGenerator::DiscreteGenerator(int vectorSize, double uniformValue)
+: DiscreteGenerator(vectorSize, uniformValue, EngineRegistry::getThreadEngine())
+{}
+
+DiscreteGenerator::DiscreteGenerator(std::uint64_t seed)
+: DiscreteGenerator(std::make_shared<Engine>(seed))
+{}
+
+DiscreteGenerator::DiscreteGenerator(std::vector<double> distributionVector,
+                                     std::uint64_t seed)
+: DiscreteGenerator(distributionVector, std::make_shared<Engine>(seed))
+{}
+
+DiscreteGenerator::DiscreteGenerator(int vectorSize,
+                                     double uniformValue,
+                                     std::uint64_t seed)
+: DiscreteGenerator(vectorSize, uniformValue, std::make_shared<Engine>(seed))
+{}
+
+DiscreteGenerator::DiscreteGenerator(std::shared_ptr<Engine> engine)
+: DiscreteGenerator(std::vector<double> {1.0, 1.0}, std::move(engine))
+{}
+
+DiscreteGenerator::DiscreteGenerator(std::vector<double> distributionVector,
+                                     std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine))
 {
+    checkEngine();
     setDistributionVector(distributionVector);
 }
 
-DiscreteGenerator::DiscreteGenerator(int vectorSize, double uniformValue)
-: m_engine(std::make_unique<Engine>())
+DiscreteGenerator::DiscreteGenerator(int vectorSize,
+                                     double uniformValue,
+                                     std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine))
 {
+    checkEngine();
     setDistributionVector(vectorSize, uniformValue);
 }
 
@@ -25,7 +59,15 @@ DiscreteGenerator::~DiscreteGenerator()
 
 int DiscreteGenerator::getNumber()
 {
-    return m_distribution(m_engine->getEngine());
+    return (*m_distribution)(*m_engine);
+}
+
+void DiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    auto &distribution = *m_distribution;
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = distribution(*m_engine);
+    }
 }
 
 void DiscreteGenerator::setDistributionVector(
@@ -59,15 +101,68 @@ void DiscreteGenerator::updateDistributionVector(double uniformValue)
     setDistribution();
 }
 
+void DiscreteGenerator::beginDistributionUpdate()
+{
+    m_updateDepth++;
+}
+
+void DiscreteGenerator::commitDistributionUpdate()
+{
+    // NB: only the outermost commit rebuilds, as the rebuild returns early
+    // while a batch is still open
+    if(m_updateDepth > 0) {
+        m_updateDepth--;
+    }
+    setDistribution();
+}
+
 std::vector<double> DiscreteGenerator::getDistributionVector()
 {
     return m_distributionVector;
 }
 
+const std::vector<double> &DiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+void DiscreteGenerator::discard(std::uint64_t count)
+{
+    // NB: std::generate_canonical<double, 53> makes max(1, ceil(53 / 32))
+    // calls on a 32 bit engine
+    constexpr std::uint64_t outputsPerNumber =
+        sizeof(Engine::result_type) < sizeof(std::uint64_t) ? 2 : 1;
+
+    // NB: with fewer than two weights there is only one number to return, so
+    // no engine output is taken for it
+    if(m_distribution->probabilities().size() < 2) {
+        return;
+    }
+
+    m_engine->advance(count * outputsPerNumber);
+}
+
+void DiscreteGenerator::setTableCacheCapacity(std::size_t capacity)
+{
+    m_tableCache.setCapacity(capacity);
+}
+
+void DiscreteGenerator::checkEngine()
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+}
+
 void DiscreteGenerator::setDistribution()
 {
-    m_distribution =
-        std::discrete_distribution<int>(m_distributionVector.begin(),
-                                        m_distributionVector.end());
+    if(m_updateDepth > 0) {
+        return;
+    }
+
+    m_distribution = m_tableCache.getTable(m_distributionVector, [this]() {
+        return std::make_shared<Distribution>(m_distributionVector.begin(),
+                                              m_distributionVector.end());
+    });
 }
 } // namespace aleatoric
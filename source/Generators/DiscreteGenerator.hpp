@@ -1,8 +1,11 @@
 #ifndef DiscreteGenerator_hpp
 #define DiscreteGenerator_hpp
 
+#include "DistributionTableCache.hpp"
 #include "IDiscreteGenerator.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <random>
 
@@ -15,7 +18,9 @@ Uses a [Permuted Congruential Generator -
 PCG](https://github.com/imneme/pcg-cpp) engine through which to produce
 random numbers according to a discrete distribution.
 
-The discrete distribution is realised with  __std::discrete_distribution__
+The discrete distribution is realised with  __std::discrete_distribution__,
+which is rebuilt on every change to the distribution vector unless the one
+built for the new vector is held in the cache (see setTableCacheCapacity()).
 */
 class DiscreteGenerator : public IDiscreteGenerator {
   public:
@@ -52,12 +57,54 @@ class DiscreteGenerator : public IDiscreteGenerator {
      */
     DiscreteGenerator(int vectorSize, double uniformValue);
 
+    /*!
+     * @brief Seeded equivalent of the default constructor
+     *
+     * All constructors taking a seed produce a reproducible sequence: two
+     * generators given the same seed and the same distribution will return
+     * identical numbers. The constructors without a seed or an engine draw from
+     * the engine of the calling thread (see EngineRegistry).
+     *
+     * @param seed seed for the underlying engine
+     */
+    explicit DiscreteGenerator(std::uint64_t seed);
+
+    /*! @brief Seeded equivalent of DiscreteGenerator(std::vector<double>) */
+    DiscreteGenerator(std::vector<double> distribution, std::uint64_t seed);
+
+    /*! @brief Seeded equivalent of DiscreteGenerator(int, double) */
+    DiscreteGenerator(int vectorSize, double uniformValue, std::uint64_t seed);
+
+    /*!
+     * @brief Equivalent of the default constructor drawing from an engine that
+     * may be shared with other generators
+     *
+     * Generators sharing an engine interleave their draws on the same
+     * sequence.
+     *
+     * @param engine engine to draw from. Must not be null.
+     */
+    explicit DiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Equivalent of DiscreteGenerator(std::vector<double>) drawing from
+     * a shared engine */
+    DiscreteGenerator(std::vector<double> distribution,
+                      std::shared_ptr<Engine> engine);
+
+    /*! @brief Equivalent of DiscreteGenerator(int, double) drawing from a
+     * shared engine */
+    DiscreteGenerator(int vectorSize,
+                      double uniformValue,
+                      std::shared_ptr<Engine> engine);
+
     ~DiscreteGenerator();
 
     /*! @brief returns generated numbers according to the discrete distribution
      * created */
     int getNumber() override;
 
+    void getNumbers(int *output, std::size_t count) override;
+
     /*! @brief sets the entire vector for the
      * distribution to a fully customised distribution
      *
@@ -88,13 +135,50 @@ class DiscreteGenerator : public IDiscreteGenerator {
      * distribution vector */
     void updateDistributionVector(double uniformValue) override;
 
+    /*! @brief defers rebuilding the distribution until
+     * commitDistributionUpdate() */
+    void beginDistributionUpdate() override;
+
+    void commitDistributionUpdate() override;
+
     /*! @brief returns the current state of the distribution vector */
     std::vector<double> getDistributionVector() override;
 
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*!
+     * @brief skips the next count numbers
+     *
+     * __std::discrete_distribution__ takes a fixed number of engine outputs
+     * for each number (two for 32 bit engines, one for pcg64), whatever the
+     * distribution, so the engine is advanced over them in O(log count) time.
+     * A distribution of fewer than two weights takes none, so the engine is
+     * left as it is.
+     */
+    void discard(std::uint64_t count) override;
+
+    /*!
+     * @brief keeps the distributions built for up to capacity distinct
+     * distribution vectors
+     *
+     * Setting a distribution vector that is held reuses its distribution
+     * rather than rebuilding it. This suits callers that return to the same
+     * few distributions, e.g. Periodic, whose distribution only ever
+     * favours one of the indices. Zero (the default) disables the cache.
+     *
+     * @param capacity the number of distributions to keep
+     */
+    void setTableCacheCapacity(std::size_t capacity);
+
   private:
-    std::unique_ptr<Engine> m_engine;
+    using Distribution = std::discrete_distribution<int>;
+
+    std::shared_ptr<Engine> m_engine;
     std::vector<double> m_distributionVector;
-    std::discrete_distribution<int> m_distribution;
+    std::shared_ptr<Distribution> m_distribution;
+    DistributionTableCache<Distribution> m_tableCache;
+    int m_updateDepth = 0;
+    void checkEngine();
     void setDistribution();
 };
 } // namespace aleatoric
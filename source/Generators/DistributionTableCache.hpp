@@ -0,0 +1,173 @@
+#ifndef DistributionTableCache_hpp
+#define DistributionTableCache_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace aleatoric {
+/*!
+@brief Holds the sampling tables built for the most recently used distribution
+vectors
+
+Protocols often return to the same few distributions, e.g. Precision across
+calls to setParams(). A generator holding a cache looks its distribution
+vector up before building a table and reuses the table it built before if
+the vector has been seen, so each distinct vector costs one O(n) build while
+it stays in the cache. Vectors are found by a hash of their weights and then
+compared in full, so a collision can never return the wrong table. The least
+recently used table is dropped once the capacity is reached.
+
+A capacity of zero (the default) disables the cache. The tables are shared
+with the generator using them, so must not be changed once built.
+*/
+template<typename Table>
+class DistributionTableCache {
+  public:
+    explicit DistributionTableCache(std::size_t capacity = 0);
+
+    /*! @brief sets the number of tables held, dropping the least recently
+     * used beyond it */
+    void setCapacity(std::size_t capacity);
+
+    std::size_t getCapacity() const;
+
+    /*! @brief returns the number of tables held */
+    std::size_t size() const;
+
+    /*!
+     * @brief returns the table for the distribution vector, calling build()
+     * to make it if it is not held
+     *
+     * @param distributionVector the weights the table is for
+     * @param build callable returning a std::shared_ptr<Table> built from the
+     * weights
+     */
+    template<typename Build>
+    std::shared_ptr<Table>
+    getTable(const std::vector<double> &distributionVector, Build build);
+
+  private:
+    struct Entry {
+        std::uint64_t hash;
+        std::vector<double> distributionVector;
+        std::shared_ptr<Table> table;
+    };
+
+    using Entries = std::list<Entry>;
+
+    std::size_t m_capacity;
+    // most recently used first
+    Entries m_entries;
+    std::unordered_multimap<std::uint64_t, typename Entries::iterator> m_index;
+
+    static std::uint64_t hash(const std::vector<double> &distributionVector);
+    static std::uint64_t mix(std::uint64_t value);
+    void evict();
+};
+
+// NB: When using templates the definitions need to be in the header or
+// available to the compiler in some other way.
+template<typename Table>
+DistributionTableCache<Table>::DistributionTableCache(std::size_t capacity)
+: m_capacity(capacity)
+{}
+
+template<typename Table>
+void DistributionTableCache<Table>::setCapacity(std::size_t capacity)
+{
+    m_capacity = capacity;
+    evict();
+}
+
+template<typename Table>
+std::size_t DistributionTableCache<Table>::getCapacity() const
+{
+    return m_capacity;
+}
+
+template<typename Table>
+std::size_t DistributionTableCache<Table>::size() const
+{
+    return m_entries.size();
+}
+
+template<typename Table>
+template<typename Build>
+std::shared_ptr<Table> DistributionTableCache<Table>::getTable(
+    const std::vector<double> &distributionVector,
+    Build build)
+{
+    if(m_capacity == 0) {
+        return build();
+    }
+
+    auto vectorHash = hash(distributionVector);
+    auto matches = m_index.equal_range(vectorHash);
+
+    for(auto match = matches.first; match != matches.second; ++match) {
+        auto entry = match->second;
+        if(entry->distributionVector == distributionVector) {
+            m_entries.splice(m_entries.begin(), m_entries, entry);
+            return entry->table;
+        }
+    }
+
+    m_entries.push_front(Entry {vectorHash, distributionVector, build()});
+    m_index.emplace(vectorHash, m_entries.begin());
+    evict();
+
+    return m_entries.front().table;
+}
+
+// Private methods
+template<typename Table>
+std::uint64_t DistributionTableCache<Table>::hash(
+    const std::vector<double> &distributionVector)
+{
+    std::uint64_t vectorHash = distributionVector.size();
+
+    for(auto &&weight : distributionVector) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &weight, sizeof(bits));
+        vectorHash = mix(vectorHash ^ bits);
+    }
+
+    return vectorHash;
+}
+
+// NB: the splitmix64 finaliser, so that weights differing in a few low bits
+// still spread across the buckets
+template<typename Table>
+std::uint64_t DistributionTableCache<Table>::mix(std::uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+template<typename Table>
+void DistributionTableCache<Table>::evict()
+{
+    while(m_entries.size() > m_capacity) {
+        auto last = std::prev(m_entries.end());
+        auto matches = m_index.equal_range(last->hash);
+
+        for(auto match = matches.first; match != matches.second; ++match) {
+            if(match->second == last) {
+                m_index.erase(match);
+                break;
+            }
+        }
+
+        m_entries.pop_back();
+    }
+}
+} // namespace aleatoric
+
+#endif /* DistributionTableCache_hpp */
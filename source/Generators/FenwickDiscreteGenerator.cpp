@@ -0,0 +1,257 @@
+#include "FenwickDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+FenwickDiscreteGenerator::FenwickDiscreteGenerator()
+: FenwickDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+FenwickDiscreteGenerator::FenwickDiscreteGenerator(
+    std::vector<double> distribution)
+: FenwickDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+FenwickDiscreteGenerator::FenwickDiscreteGenerator(
+    std::vector<double> distribution,
+    std::uint64_t seed)
+: FenwickDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+FenwickDiscreteGenerator::FenwickDiscreteGenerator(
+    std::shared_ptr<Engine> engine)
+: FenwickDiscreteGenerator(std::vector<double> {1.0, 1.0}, std::move(engine))
+{}
+
+FenwickDiscreteGenerator::FenwickDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)), m_distributionVector(distribution)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    buildTree();
+}
+
+FenwickDiscreteGenerator::~FenwickDiscreteGenerator()
+{}
+
+int FenwickDiscreteGenerator::getNumber()
+{
+    if(m_distributionVector.empty()) {
+        return 0;
+    }
+
+    return selectIndex(m_engine->getUnitNumber());
+}
+
+void FenwickDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    if(m_distributionVector.empty()) {
+        std::fill(output, output + count, 0);
+        return;
+    }
+
+    double unitNumbers[Engine::bufferSize];
+
+    for(std::size_t done = 0; done < count; done += Engine::bufferSize) {
+        auto blockCount = std::min(Engine::bufferSize, count - done);
+        m_engine->generateUnitNumbers(unitNumbers, blockCount);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            output[done + i] = selectIndex(unitNumbers[i]);
+        }
+    }
+}
+
+void FenwickDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    m_distributionVector = distributionVector;
+    buildTree();
+}
+
+void FenwickDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                     double uniformValue)
+{
+    m_distributionVector.assign(vectorSize, uniformValue);
+    buildTree();
+}
+
+void FenwickDiscreteGenerator::updateDistributionVector(int index,
+                                                        double newValue)
+{
+    auto oldValue = m_distributionVector[index];
+    m_distributionVector[index] = newValue;
+
+    auto supportChange =
+        static_cast<int>(newValue > 0.0) - static_cast<int>(oldValue > 0.0);
+    if(supportChange != 0) {
+        m_supportSize += supportChange;
+        for(std::size_t node = index + 1; node < m_supportTree.size();
+            node += node & (~node + 1)) {
+            m_supportTree[node] += supportChange;
+        }
+    }
+
+    // NB: the sums are adjusted by the difference, which can leave rounding
+    // errors behind. With every weight at zero the sums are known to be zero,
+    // so they are cleared rather than left to bias the uniform fallback.
+    if(m_supportSize == 0) {
+        std::fill(m_tree.begin(), m_tree.end(), 0.0);
+        m_total = 0.0;
+        return;
+    }
+
+    auto difference = newValue - oldValue;
+    for(std::size_t node = index + 1; node < m_tree.size();
+        node += node & (~node + 1)) {
+        m_tree[node] += difference;
+    }
+
+    m_total = getPrefixSum(m_distributionVector.size());
+}
+
+void FenwickDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    for(auto &&i : m_distributionVector) {
+        i = uniformValue;
+    }
+    buildTree();
+}
+
+std::vector<double> FenwickDiscreteGenerator::getDistributionVector()
+{
+    return m_distributionVector;
+}
+
+const std::vector<double> &FenwickDiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+std::size_t FenwickDiscreteGenerator::getSupportSize()
+{
+    return static_cast<std::size_t>(m_supportSize);
+}
+
+void FenwickDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->advance(count * Engine::outputsPerUnitNumber);
+}
+
+// Private methods
+void FenwickDiscreteGenerator::buildTree()
+{
+    auto size = m_distributionVector.size();
+    m_tree.assign(size + 1, 0.0);
+    m_supportTree.assign(size + 1, 0);
+
+    // each node adds its sum to the one node above it
+    for(std::size_t node = 1; node <= size; node++) {
+        m_tree[node] += m_distributionVector[node - 1];
+        m_supportTree[node] += m_distributionVector[node - 1] > 0.0 ? 1 : 0;
+        auto parent = node + (node & (~node + 1));
+        if(parent <= size) {
+            m_tree[parent] += m_tree[node];
+            m_supportTree[parent] += m_supportTree[node];
+        }
+    }
+
+    m_supportSize = getSupportCount(size);
+
+    m_topStep = 1;
+    while(m_topStep * 2 <= size) {
+        m_topStep *= 2;
+    }
+
+    m_total = getPrefixSum(size);
+}
+
+double FenwickDiscreteGenerator::getPrefixSum(std::size_t count) const
+{
+    double sum = 0.0;
+    for(auto node = count; node > 0; node -= node & (~node + 1)) {
+        sum += m_tree[node];
+    }
+    return sum;
+}
+
+int FenwickDiscreteGenerator::getSupportCount(std::size_t count) const
+{
+    int supportCount = 0;
+    for(auto node = count; node > 0; node -= node & (~node + 1)) {
+        supportCount += m_supportTree[node];
+    }
+    return supportCount;
+}
+
+int FenwickDiscreteGenerator::findWeightedIndex(int rank) const
+{
+    // Find the number of leading weights of which fewer than rank are above
+    // zero: that is the index of the weight of that rank
+    auto size = m_distributionVector.size();
+    std::size_t position = 0;
+
+    for(auto step = m_topStep; step > 0; step >>= 1) {
+        auto next = position + step;
+        if(next <= size && m_supportTree[next] < rank) {
+            position = next;
+            rank -= m_supportTree[next];
+        }
+    }
+
+    return static_cast<int>(position);
+}
+
+int FenwickDiscreteGenerator::findNearestWeightedIndex(std::size_t index) const
+{
+    auto size = m_distributionVector.size();
+
+    if(m_supportSize == 0) {
+        return static_cast<int>(std::min(index, size - 1));
+    }
+
+    // NB: the nearest weight above zero at or below the index, or else the
+    // first one above it
+    auto rank = getSupportCount(std::min(index + 1, size));
+    return findWeightedIndex(rank > 0 ? rank : 1);
+}
+
+int FenwickDiscreteGenerator::selectIndex(double unitNumber) const
+{
+    auto size = m_distributionVector.size();
+
+    if(m_total <= 0.0) {
+        return static_cast<int>(unitNumber * size);
+    }
+
+    // Find the number of leading weights whose sum does not exceed the
+    // target: that is the index selected. Zero weights add nothing to the
+    // sum, so are passed over.
+    auto remaining = unitNumber * m_total;
+    std::size_t position = 0;
+
+    for(auto step = m_topStep; step > 0; step >>= 1) {
+        auto next = position + step;
+        if(next <= size && m_tree[next] <= remaining) {
+            position = next;
+            remaining -= m_tree[next];
+        }
+    }
+
+    // NB: rounding can put the target at the very top of the total, or on a
+    // zero weight
+    if(position == size || m_distributionVector[position] <= 0.0) {
+        return findNearestWeightedIndex(position);
+    }
+
+    return static_cast<int>(position);
+}
+} // namespace aleatoric
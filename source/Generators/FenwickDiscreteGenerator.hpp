@@ -0,0 +1,103 @@
+#ifndef FenwickDiscreteGenerator_hpp
+#define FenwickDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution whose weights change
+one at a time
+
+The weights are held in a [Fenwick
+tree](https://en.wikipedia.org/wiki/Fenwick_tree), each node of which holds
+the sum of a block of weights. Selecting a number descends the tree with one
+unit number from the engine and updating a single weight adjusts the nodes
+covering it, both in O(log n) time. DiscreteGenerator rebuilds its whole
+distribution, in O(n) time, whenever a weight changes.
+
+This suits the protocols built on the SeriesPrinciple (e.g. Serial and Ratio),
+which zero one weight after every number. Setting or updating every weight
+builds the tree in O(n) time. As single updates adjust the sums by the change
+in weight, the sums can drift by rounding errors; they are cleared when the
+last weight above zero is zeroed. If every weight is zero, every index is
+equally likely.
+*/
+class FenwickDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    FenwickDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit FenwickDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    FenwickDiscreteGenerator(std::vector<double> distribution,
+                             std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit FenwickDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    FenwickDiscreteGenerator(std::vector<double> distribution,
+                             std::shared_ptr<Engine> engine);
+
+    ~FenwickDiscreteGenerator();
+
+    int getNumber() override;
+
+    /*! @brief writes count numbers to output, generating the unit numbers
+     * they take a block at a time */
+    void getNumbers(int *output, std::size_t count) override;
+
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    /*! @brief updates a single weight in O(log n) time */
+    void updateDistributionVector(int index, double newValue) override;
+
+    void updateDistributionVector(double uniformValue) override;
+
+    std::vector<double> getDistributionVector() override;
+
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief returns the number of weights above zero, in constant time */
+    std::size_t getSupportSize() override;
+
+    /*! @brief skips the next count numbers by advancing the engine, as each
+     * number takes one unit number */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<Engine> m_engine;
+    std::vector<double> m_distributionVector;
+    // NB: 1 based, so that node i covers the (i & -i) weights ending at i
+    std::vector<double> m_tree;
+    // NB: counts the weights above zero in the same way, exactly
+    std::vector<int> m_supportTree;
+    int m_supportSize;
+    std::size_t m_topStep;
+    double m_total;
+    void buildTree();
+    double getPrefixSum(std::size_t count) const;
+    int getSupportCount(std::size_t count) const;
+    int findWeightedIndex(int rank) const;
+    int findNearestWeightedIndex(std::size_t index) const;
+    int selectIndex(double unitNumber) const;
+};
+} // namespace aleatoric
+
+#endif /* FenwickDiscreteGenerator_hpp */
@@ -2,6 +2,9 @@
 #ifndef IDiscreteGenerator_hpp
 #define IDiscreteGenerator_hpp
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace aleatoric {
@@ -12,6 +15,16 @@ class IDiscreteGenerator {
     /*! @brief pure virtual method for returning generated numbers */
     virtual int getNumber() = 0;
 
+    /*! @brief writes count generated numbers to output, as if getNumber() had
+     * been called count times. Implementations override the default to avoid
+     * a virtual call per number. */
+    virtual void getNumbers(int *output, std::size_t count)
+    {
+        for(std::size_t i = 0; i < count; i++) {
+            output[i] = getNumber();
+        }
+    }
+
     /*! @brief pure virtual method for setting the distribution vector */
     virtual void
     setDistributionVector(std::vector<double> distributionVector) = 0;
@@ -26,10 +39,81 @@ class IDiscreteGenerator {
     /*! @brief pure virtual method for updating the distribution vector */
     virtual void updateDistributionVector(double uniformValue) = 0;
 
+    /*!
+     * @brief Starts a batch of changes to the distribution vector
+     *
+     * Generators that rebuild their distribution after every change defer
+     * the rebuild until commitDistributionUpdate(), so the whole batch costs
+     * one rebuild. Batches can be nested, in which case only the outermost
+     * commit rebuilds. The default does nothing, for generators whose changes
+     * are cheap.
+     *
+     * The result of getNumber() or getNumbers() while a batch is open is
+     * undefined. Prefer DistributionUpdate, which commits the batch however
+     * its scope is left.
+     */
+    virtual void beginDistributionUpdate()
+    {}
+
+    /*! @brief ends a batch of changes started by beginDistributionUpdate() */
+    virtual void commitDistributionUpdate()
+    {}
+
     /*! @brief pure virtual method for getting the distribution vector */
     virtual std::vector<double> getDistributionVector() = 0;
+
+    /*! @brief pure virtual method for reading the distribution vector without
+     * copying it. The reference is valid until the distribution is next
+     * changed. */
+    virtual const std::vector<double> &viewDistributionVector() = 0;
+
+    /*! @brief returns the size of the distribution vector. Implementations
+     * that do not hold the vector densely override it. */
+    virtual std::size_t getDistributionSize()
+    {
+        return viewDistributionVector().size();
+    }
+
+    /*! @brief returns the number of weights above zero. The default counts
+     * them; implementations that track them override it. */
+    virtual std::size_t getSupportSize()
+    {
+        const auto &distributionVector = viewDistributionVector();
+        return static_cast<std::size_t>(
+            std::count_if(distributionVector.begin(),
+                          distributionVector.end(),
+                          [](double weight) { return weight > 0.0; }));
+    }
+
+    /*! @brief pure virtual method for skipping the next count numbers, leaving
+     * the generator as if getNumber() had been called count times */
+    virtual void discard(std::uint64_t count) = 0;
     virtual ~IDiscreteGenerator() = default;
 };
+
+/*! @brief Batches the changes made to a generator's distribution for the
+ * lifetime of the object, committing them when it is destroyed, including
+ * when an exception leaves the scope (see
+ * IDiscreteGenerator::beginDistributionUpdate) */
+class DistributionUpdate {
+  public:
+    explicit DistributionUpdate(IDiscreteGenerator &generator)
+    : m_generator(generator)
+    {
+        m_generator.beginDistributionUpdate();
+    }
+
+    ~DistributionUpdate()
+    {
+        m_generator.commitDistributionUpdate();
+    }
+
+    DistributionUpdate(const DistributionUpdate &) = delete;
+    DistributionUpdate &operator=(const DistributionUpdate &) = delete;
+
+  private:
+    IDiscreteGenerator &m_generator;
+};
 } // namespace aleatoric
 
 #endif /* IDiscreteGenerator_hpp */
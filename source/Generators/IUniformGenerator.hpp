@@ -2,6 +2,9 @@
 #ifndef IUniformGenerator_hpp
 #define IUniformGenerator_hpp
 
+#include <cstddef>
+#include <cstdint>
+
 namespace aleatoric {
 /*! @brief An interface abstract class from which the UniformGenerator class is
  * derived */
@@ -9,9 +12,24 @@ class IUniformGenerator {
   public:
     /*! @brief pure virtual method for returning generated numbers */
     virtual int getNumber() = 0;
+    /*! @brief pure virtual method for returning a generated number from the
+     * range given, leaving the distribution unchanged */
+    virtual int getNumber(int rangeStart, int rangeEnd) = 0;
+    /*! @brief writes count generated numbers to output, as if getNumber() had
+     * been called count times. Implementations override the default to avoid
+     * a virtual call per number. */
+    virtual void getNumbers(int *output, std::size_t count)
+    {
+        for(std::size_t i = 0; i < count; i++) {
+            output[i] = getNumber();
+        }
+    }
     /*! @brief pure virtual method for setting the distribution for the uniform
      * generator */
     virtual void setDistribution(int rangeStart, int rangeEnd) = 0;
+    /*! @brief pure virtual method for skipping the next count numbers, leaving
+     * the generator as if getNumber() had been called count times */
+    virtual void discard(std::uint64_t count) = 0;
     virtual ~IUniformGenerator() = default;
 };
 } // namespace aleatoric
@@ -0,0 +1,189 @@
+#include "PrefixSumDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+#include "PrefixSumSearch.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+PrefixSumDiscreteGenerator::PrefixSumDiscreteGenerator()
+: PrefixSumDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+PrefixSumDiscreteGenerator::PrefixSumDiscreteGenerator(
+    std::vector<double> distribution)
+: PrefixSumDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+PrefixSumDiscreteGenerator::PrefixSumDiscreteGenerator(
+    std::vector<double> distribution,
+    std::uint64_t seed)
+: PrefixSumDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+PrefixSumDiscreteGenerator::PrefixSumDiscreteGenerator(
+    std::shared_ptr<Engine> engine)
+: PrefixSumDiscreteGenerator(std::vector<double> {1.0, 1.0},
+                             std::move(engine))
+{}
+
+PrefixSumDiscreteGenerator::PrefixSumDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)), m_distributionVector(distribution)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setPrefixSums();
+}
+
+PrefixSumDiscreteGenerator::~PrefixSumDiscreteGenerator()
+{}
+
+int PrefixSumDiscreteGenerator::getNumber()
+{
+    if(m_distributionVector.empty()) {
+        return 0;
+    }
+
+    return selectIndex(m_engine->getUnitNumber());
+}
+
+void PrefixSumDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    if(m_distributionVector.empty()) {
+        std::fill(output, output + count, 0);
+        return;
+    }
+
+    double unitNumbers[Engine::bufferSize];
+
+    for(std::size_t done = 0; done < count; done += Engine::bufferSize) {
+        auto blockCount = std::min(Engine::bufferSize, count - done);
+        m_engine->generateUnitNumbers(unitNumbers, blockCount);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            output[done + i] = selectIndex(unitNumbers[i]);
+        }
+    }
+}
+
+void PrefixSumDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    m_distributionVector = distributionVector;
+    setPrefixSums();
+}
+
+void PrefixSumDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                       double uniformValue)
+{
+    m_distributionVector.assign(vectorSize, uniformValue);
+    setPrefixSums();
+}
+
+void PrefixSumDiscreteGenerator::updateDistributionVector(int index,
+                                                          double newValue)
+{
+    m_distributionVector[index] = newValue;
+    setPrefixSums();
+}
+
+void PrefixSumDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    for(auto &&i : m_distributionVector) {
+        i = uniformValue;
+    }
+    setPrefixSums();
+}
+
+void PrefixSumDiscreteGenerator::beginDistributionUpdate()
+{
+    m_updateDepth++;
+}
+
+void PrefixSumDiscreteGenerator::commitDistributionUpdate()
+{
+    if(m_updateDepth > 0) {
+        m_updateDepth--;
+    }
+    setPrefixSums();
+}
+
+std::vector<double> PrefixSumDiscreteGenerator::getDistributionVector()
+{
+    return m_distributionVector;
+}
+
+const std::vector<double> &PrefixSumDiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+void PrefixSumDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->advance(count * Engine::outputsPerUnitNumber);
+}
+
+// Private methods
+void PrefixSumDiscreteGenerator::setPrefixSums()
+{
+    if(m_updateDepth > 0) {
+        return;
+    }
+
+    auto size = m_distributionVector.size();
+    m_prefixSums.resize(PrefixSumSearch::getPaddedSize(size));
+    PrefixSumSearch::build(m_distributionVector.data(),
+                           size,
+                           m_prefixSums.data());
+
+    m_total = size > 0 ? m_prefixSums[size - 1] : 0.0f;
+}
+
+int PrefixSumDiscreteGenerator::findNearestWeightedIndex(
+    std::size_t index) const
+{
+    auto size = m_distributionVector.size();
+
+    for(auto i = std::min(index + 1, size); i > 0; i--) {
+        if(m_distributionVector[i - 1] > 0.0) {
+            return static_cast<int>(i - 1);
+        }
+    }
+
+    for(auto i = index; i < size; i++) {
+        if(m_distributionVector[i] > 0.0) {
+            return static_cast<int>(i);
+        }
+    }
+
+    return static_cast<int>(std::min(index, size - 1));
+}
+
+int PrefixSumDiscreteGenerator::selectIndex(double unitNumber) const
+{
+    auto size = m_distributionVector.size();
+
+    if(m_total <= 0.0f) {
+        return static_cast<int>(unitNumber * size);
+    }
+
+    auto target = static_cast<float>(unitNumber * m_total);
+    auto index = PrefixSumSearch::count(m_prefixSums.data(),
+                                        m_prefixSums.size(),
+                                        target);
+
+    // NB: rounding can put the target at the very top of the total, or on a
+    // zero weight (see PrefixSumSearch)
+    if(index >= size || m_distributionVector[index] <= 0.0) {
+        return findNearestWeightedIndex(index);
+    }
+
+    return static_cast<int>(index);
+}
+} // namespace aleatoric
@@ -0,0 +1,97 @@
+#ifndef PrefixSumDiscreteGenerator_hpp
+#define PrefixSumDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution by searching its float
+prefix sums with SIMD
+
+The prefix sums of the weights are held as floats and rebuilt on every change
+to the distribution vector, and a number is selected by counting the sums at
+or below a unit number scaled to the total (see PrefixSumSearch). Both take
+O(n) time but handle several weights per instruction, so for distributions of
+up to around a thousand weights that change between numbers (e.g. those of
+AdjacentSteps) this is quicker than the O(log n) search and O(n) rebuild of
+DiscreteGenerator, or the O(n) rebuild of AliasDiscreteGenerator.
+
+Weights are summed in single precision, so a weight below about 2^-24 of the
+total may never be selected. If every weight is zero, every index is equally
+likely.
+*/
+class PrefixSumDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    PrefixSumDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit PrefixSumDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    PrefixSumDiscreteGenerator(std::vector<double> distribution,
+                               std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit PrefixSumDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    PrefixSumDiscreteGenerator(std::vector<double> distribution,
+                               std::shared_ptr<Engine> engine);
+
+    ~PrefixSumDiscreteGenerator();
+
+    int getNumber() override;
+
+    /*! @brief writes count numbers to output, generating the unit numbers
+     * they take a block at a time */
+    void getNumbers(int *output, std::size_t count) override;
+
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    void updateDistributionVector(int index, double newValue) override;
+
+    void updateDistributionVector(double uniformValue) override;
+
+    /*! @brief defers rebuilding the prefix sums until
+     * commitDistributionUpdate() */
+    void beginDistributionUpdate() override;
+
+    void commitDistributionUpdate() override;
+
+    std::vector<double> getDistributionVector() override;
+
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief skips the next count numbers by advancing the engine, as each
+     * number takes one unit number */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<Engine> m_engine;
+    std::vector<double> m_distributionVector;
+    // NB: padded to whole blocks of PrefixSumSearch::blockSize
+    std::vector<float> m_prefixSums;
+    float m_total = 0.0f;
+    int m_updateDepth = 0;
+    void setPrefixSums();
+    int findNearestWeightedIndex(std::size_t index) const;
+    int selectIndex(double unitNumber) const;
+};
+} // namespace aleatoric
+
+#endif /* PrefixSumDiscreteGenerator_hpp */
@@ -0,0 +1,225 @@
+#include "PrefixSumSearch.hpp"
+
+#include <limits>
+
+#if(defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define ALEATORIC_SIMD_PREFIX_SUMS 1
+#include <immintrin.h>
+#endif
+
+namespace aleatoric {
+constexpr std::size_t PrefixSumSearch::blockSize;
+
+namespace {
+constexpr std::size_t scanWidth = 4;
+
+// Sums scanWidth weights onto carry in the order of the SSE2 scan: each item
+// is first added to the one before it, then to the result two before it
+inline void scanBlock(const float *weights, float carry, float *prefixSums)
+{
+    float first[scanWidth] = {weights[0],
+                              weights[1] + weights[0],
+                              weights[2] + weights[1],
+                              weights[3] + weights[2]};
+
+    prefixSums[0] = carry + first[0];
+    prefixSums[1] = carry + first[1];
+    prefixSums[2] = carry + (first[2] + first[0]);
+    prefixSums[3] = carry + (first[3] + first[1]);
+}
+
+// Sums the weights from start, fewer than scanWidth, as if the block were
+// completed with zeros, and pads the prefix sums from size with infinity
+void finishScan(const double *weights,
+                std::size_t start,
+                std::size_t size,
+                std::size_t paddedSize,
+                float carry,
+                float *prefixSums)
+{
+    if(start < size) {
+        float block[scanWidth] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for(std::size_t i = start; i < size; i++) {
+            block[i - start] = static_cast<float>(weights[i]);
+        }
+
+        float sums[scanWidth];
+        scanBlock(block, carry, sums);
+        for(std::size_t i = start; i < size; i++) {
+            prefixSums[i] = sums[i - start];
+        }
+    }
+
+    for(std::size_t i = size; i < paddedSize; i++) {
+        prefixSums[i] = std::numeric_limits<float>::infinity();
+    }
+}
+
+#ifdef ALEATORIC_SIMD_PREFIX_SUMS
+__attribute__((target("sse2"))) void
+buildSse2(const double *weights, std::size_t size, float *prefixSums)
+{
+    auto carry = _mm_setzero_ps();
+    std::size_t blocks = size / scanWidth;
+
+    for(std::size_t i = 0; i < blocks * scanWidth; i += scanWidth) {
+        auto sums = _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(weights + i)),
+                                  _mm_cvtpd_ps(_mm_loadu_pd(weights + i + 2)));
+        sums = _mm_add_ps(
+            sums,
+            _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(sums), 4)));
+        sums = _mm_add_ps(
+            sums,
+            _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(sums), 8)));
+        sums = _mm_add_ps(carry, sums);
+
+        _mm_storeu_ps(prefixSums + i, sums);
+        carry = _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    finishScan(weights,
+               blocks * scanWidth,
+               size,
+               PrefixSumSearch::getPaddedSize(size),
+               _mm_cvtss_f32(carry),
+               prefixSums);
+}
+
+// NB: the search ends at the first block with a sum above the target, and the
+// number of trailing set bits in its mask gives the sums before that one
+__attribute__((target("sse2"))) std::size_t
+countSse2(const float *prefixSums, std::size_t paddedSize, float target)
+{
+    auto targets = _mm_set1_ps(target);
+
+    for(std::size_t i = 0; i < paddedSize; i += scanWidth) {
+        auto atOrBelow = _mm_movemask_ps(
+            _mm_cmple_ps(_mm_loadu_ps(prefixSums + i), targets));
+        if(atOrBelow != 0xf) {
+            return i + __builtin_ctz(~atOrBelow);
+        }
+    }
+
+    return paddedSize;
+}
+
+__attribute__((target("avx2"))) std::size_t
+countAvx2(const float *prefixSums, std::size_t paddedSize, float target)
+{
+    auto targets = _mm256_set1_ps(target);
+
+    for(std::size_t i = 0; i < paddedSize; i += PrefixSumSearch::blockSize) {
+        auto atOrBelow = _mm256_movemask_ps(_mm256_cmp_ps(
+            _mm256_loadu_ps(prefixSums + i), targets, _CMP_LE_OQ));
+        if(atOrBelow != 0xff) {
+            return i + __builtin_ctz(~atOrBelow);
+        }
+    }
+
+    return paddedSize;
+}
+#endif
+
+bool cpuSupportsSse2()
+{
+#ifdef ALEATORIC_SIMD_PREFIX_SUMS
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#else
+    return false;
+#endif
+}
+
+bool cpuSupportsAvx2()
+{
+#ifdef ALEATORIC_SIMD_PREFIX_SUMS
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+bool usesAvx2()
+{
+    static const bool supported = cpuSupportsAvx2();
+    return supported;
+}
+} // namespace
+
+std::size_t PrefixSumSearch::getPaddedSize(std::size_t size)
+{
+    return (size + blockSize - 1) / blockSize * blockSize;
+}
+
+void PrefixSumSearch::build(const double *weights,
+                            std::size_t size,
+                            float *prefixSums)
+{
+#ifdef ALEATORIC_SIMD_PREFIX_SUMS
+    if(usesSimd()) {
+        buildSse2(weights, size, prefixSums);
+        return;
+    }
+#endif
+    buildScalar(weights, size, prefixSums);
+}
+
+void PrefixSumSearch::buildScalar(const double *weights,
+                                  std::size_t size,
+                                  float *prefixSums)
+{
+    float carry = 0.0f;
+    std::size_t blocks = size / scanWidth;
+
+    for(std::size_t i = 0; i < blocks * scanWidth; i += scanWidth) {
+        float block[scanWidth];
+        for(std::size_t j = 0; j < scanWidth; j++) {
+            block[j] = static_cast<float>(weights[i + j]);
+        }
+
+        scanBlock(block, carry, prefixSums + i);
+        carry = prefixSums[i + scanWidth - 1];
+    }
+
+    finishScan(weights,
+               blocks * scanWidth,
+               size,
+               getPaddedSize(size),
+               carry,
+               prefixSums);
+}
+
+std::size_t PrefixSumSearch::count(const float *prefixSums,
+                                   std::size_t paddedSize,
+                                   float target)
+{
+#ifdef ALEATORIC_SIMD_PREFIX_SUMS
+    if(usesAvx2()) {
+        return countAvx2(prefixSums, paddedSize, target);
+    }
+    if(usesSimd()) {
+        return countSse2(prefixSums, paddedSize, target);
+    }
+#endif
+    return countScalar(prefixSums, paddedSize, target);
+}
+
+std::size_t PrefixSumSearch::countScalar(const float *prefixSums,
+                                         std::size_t paddedSize,
+                                         float target)
+{
+    std::size_t count = 0;
+    while(count < paddedSize && prefixSums[count] <= target) {
+        count++;
+    }
+    return count;
+}
+
+bool PrefixSumSearch::usesSimd()
+{
+    static const bool supported = cpuSupportsSse2();
+    return supported;
+}
+} // namespace aleatoric
@@ -0,0 +1,73 @@
+#ifndef PrefixSumSearch_hpp
+#define PrefixSumSearch_hpp
+
+#include <cstddef>
+
+namespace aleatoric {
+/*!
+@brief Builds and searches the float prefix sums of a set of weights several
+at a time
+
+The prefix sums are held in blocks of blockSize floats, with the blocks after
+the last weight filled with infinity so that a search never needs a bounds
+check. The sums are built four at a time with a fixed order of additions,
+whichever implementation is used, so the sums (and so the numbers a generator
+selects with them) do not depend on the CPU. As the additions within a block
+are reordered, a sum can differ by a rounding error from the one that would
+be made adding the weights in turn; in particular, a sum after a zero weight
+can differ slightly from the one before it. Searches compare a block of sums
+with a target at a time.
+
+SSE2 implementations, and an AVX2 implementation of count(), are selected at
+runtime when the CPU supports them. A scalar implementation with the same
+results is used otherwise.
+*/
+class PrefixSumSearch {
+  public:
+    /*! @brief the number of floats in a block */
+    static constexpr std::size_t blockSize = 8;
+
+    /*! @brief returns the number of floats needed to hold the prefix sums of
+     * size weights, i.e. size rounded up to a whole number of blocks */
+    static std::size_t getPaddedSize(std::size_t size);
+
+    /*!
+     * @brief Writes the prefix sums of the weights
+     *
+     * @param weights the weights to sum
+     * @param size the number of weights
+     * @param prefixSums destination for getPaddedSize(size) floats. Item i
+     * receives the sum of weights 0 to i, and items from size receive
+     * infinity.
+     */
+    static void
+    build(const double *weights, std::size_t size, float *prefixSums);
+
+    /*! @brief scalar implementation of build(), used as the fallback */
+    static void
+    buildScalar(const double *weights, std::size_t size, float *prefixSums);
+
+    /*!
+     * @brief Returns the number of leading prefix sums at or below the target
+     *
+     * This is the index of the first sum above the target, i.e. the index that
+     * the target selects, or paddedSize if there is none.
+     *
+     * @param prefixSums prefix sums written by build()
+     * @param paddedSize the number of floats written by build()
+     * @param target the value to search for
+     */
+    static std::size_t
+    count(const float *prefixSums, std::size_t paddedSize, float target);
+
+    /*! @brief scalar implementation of count(), used as the fallback */
+    static std::size_t
+    countScalar(const float *prefixSums, std::size_t paddedSize, float target);
+
+    /*! @brief returns whether build() and count() use SIMD implementations
+     * (SSE2 at least) */
+    static bool usesSimd();
+};
+} // namespace aleatoric
+
+#endif /* PrefixSumSearch_hpp */
@@ -0,0 +1,192 @@
+#include "ResettableDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+ResettableDiscreteGenerator::ResettableDiscreteGenerator()
+: ResettableDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+ResettableDiscreteGenerator::ResettableDiscreteGenerator(
+    std::vector<double> distribution)
+: ResettableDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+ResettableDiscreteGenerator::ResettableDiscreteGenerator(
+    std::vector<double> distribution,
+    std::uint64_t seed)
+: ResettableDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+ResettableDiscreteGenerator::ResettableDiscreteGenerator(
+    std::shared_ptr<Engine> engine)
+: ResettableDiscreteGenerator(std::vector<double> {1.0, 1.0},
+                              std::move(engine))
+{}
+
+ResettableDiscreteGenerator::ResettableDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)),
+  m_baseValue(0.0),
+  m_epoch(0),
+  m_distributionVectorIsCurrent(false)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setDistributionVector(distribution);
+}
+
+ResettableDiscreteGenerator::~ResettableDiscreteGenerator()
+{}
+
+int ResettableDiscreteGenerator::getNumber()
+{
+    auto size = m_updatedValues.size();
+    if(size == 0) {
+        return 0;
+    }
+
+    auto baseTotal = m_baseValue * (size - m_updatedIndices.size());
+    auto total = baseTotal + m_updatedTotal;
+    auto unitNumber = m_engine->getUnitNumber();
+
+    if(total <= 0.0) {
+        return static_cast<int>(unitNumber * size);
+    }
+
+    auto target = unitNumber * total;
+
+    // NB: rounding can put the target at the very top of the total
+    if(target < baseTotal || m_updatedTotal <= 0.0) {
+        // every index not updated is equally likely. The target gives the
+        // first index to try.
+        auto index = std::min(
+            static_cast<std::size_t>(target / baseTotal * size), size - 1);
+        while(isUpdated(index)) {
+            index = m_engine->getBoundedNumber(
+                static_cast<std::uint32_t>(size));
+        }
+        return static_cast<int>(index);
+    }
+
+    target -= baseTotal;
+    int lastWeightedIndex = m_updatedIndices.front();
+
+    for(auto &&index : m_updatedIndices) {
+        auto value = m_updatedValues[index];
+        if(value > 0.0) {
+            if(target < value) {
+                return index;
+            }
+            target -= value;
+            lastWeightedIndex = index;
+        }
+    }
+
+    return lastWeightedIndex;
+}
+
+void ResettableDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    // NB: the draws each number takes vary, so they cannot be made in bulk
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = ResettableDiscreteGenerator::getNumber();
+    }
+}
+
+void ResettableDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    auto baseValue = distributionVector.empty() ? 0.0 : distributionVector[0];
+    setDistributionVector(distributionVector.size(), baseValue);
+
+    for(size_t i = 1; i < distributionVector.size(); i++) {
+        if(distributionVector[i] != baseValue) {
+            updateDistributionVector(i, distributionVector[i]);
+        }
+    }
+}
+
+void ResettableDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                        double uniformValue)
+{
+    m_updatedValues.assign(vectorSize, 0.0);
+    m_updateEpochs.assign(vectorSize, 0);
+    m_epoch = 0;
+    updateDistributionVector(uniformValue);
+}
+
+void ResettableDiscreteGenerator::updateDistributionVector(int index,
+                                                           double newValue)
+{
+    if(isUpdated(index)) {
+        m_updatedTotal += newValue - m_updatedValues[index];
+    } else {
+        m_updateEpochs[index] = m_epoch;
+        m_updatedIndices.push_back(index);
+        m_updatedTotal += newValue;
+    }
+
+    m_updatedValues[index] = newValue;
+    m_distributionVectorIsCurrent = false;
+}
+
+void ResettableDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    m_baseValue = uniformValue;
+    startEpoch();
+}
+
+std::vector<double> ResettableDiscreteGenerator::getDistributionVector()
+{
+    return viewDistributionVector();
+}
+
+const std::vector<double> &
+ResettableDiscreteGenerator::viewDistributionVector()
+{
+    if(!m_distributionVectorIsCurrent) {
+        m_distributionVector.assign(m_updatedValues.size(), m_baseValue);
+        for(auto &&index : m_updatedIndices) {
+            m_distributionVector[index] = m_updatedValues[index];
+        }
+        m_distributionVectorIsCurrent = true;
+    }
+
+    return m_distributionVector;
+}
+
+void ResettableDiscreteGenerator::discard(std::uint64_t count)
+{
+    for(std::uint64_t i = 0; i < count; i++) {
+        getNumber();
+    }
+}
+
+// Private methods
+void ResettableDiscreteGenerator::startEpoch()
+{
+    m_updatedIndices.clear();
+    m_updatedTotal = 0.0;
+    m_distributionVectorIsCurrent = false;
+
+    // NB: once the epoch wraps round, stamps from the last time round would
+    // look current, so they are cleared. Stamp 0 is never current.
+    if(++m_epoch == 0) {
+        std::fill(m_updateEpochs.begin(), m_updateEpochs.end(), 0);
+        m_epoch = 1;
+    }
+}
+
+bool ResettableDiscreteGenerator::isUpdated(std::size_t index) const
+{
+    return m_updateEpochs[index] == m_epoch;
+}
+} // namespace aleatoric
@@ -0,0 +1,101 @@
+#ifndef ResettableDiscreteGenerator_hpp
+#define ResettableDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution whose weights are
+repeatedly reset to a uniform value
+
+The distribution is held as a base value shared by every index plus the
+values of the indices updated since the last reset. Each update is stamped
+with the current epoch and a reset starts a new epoch, so stamps from earlier
+epochs no longer count and resetting every weight takes constant time.
+DiscreteGenerator rewrites every weight and rebuilds its distribution, in O(n)
+time.
+
+A number is selected in O(k) time, where k is the number of indices updated
+since the last reset. An index with the base value is chosen by picking
+indices at random until one has not been updated, so this generator suits
+protocols that reset the weights and then update only a few (e.g.
+NoRepetition and AdjacentSteps). If every weight is zero, every index is
+equally likely.
+*/
+class ResettableDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    ResettableDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit ResettableDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    ResettableDiscreteGenerator(std::vector<double> distribution,
+                                std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit ResettableDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    ResettableDiscreteGenerator(std::vector<double> distribution,
+                                std::shared_ptr<Engine> engine);
+
+    ~ResettableDiscreteGenerator();
+
+    int getNumber() override;
+
+    void getNumbers(int *output, std::size_t count) override;
+
+    /*! @brief sets the distribution. The value of the first item becomes the
+     * base value and the items that differ from it are held as updates. */
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    /*! @brief updates a single weight in constant time */
+    void updateDistributionVector(int index, double newValue) override;
+
+    /*! @brief resets every weight to the value given in constant time */
+    void updateDistributionVector(double uniformValue) override;
+
+    /*! @brief returns the distribution, built from the base value and the
+     * updates */
+    std::vector<double> getDistributionVector() override;
+
+    /*! @brief returns the distribution, which is built from the base value and
+     * the updates the first time it is read after a change */
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief skips the next count numbers. The draws each number takes vary,
+     * so the numbers are selected and thrown away. */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<Engine> m_engine;
+    double m_baseValue;
+    std::vector<double> m_updatedValues;
+    std::vector<std::uint32_t> m_updateEpochs;
+    std::uint32_t m_epoch;
+    std::vector<int> m_updatedIndices;
+    double m_updatedTotal;
+    std::vector<double> m_distributionVector;
+    bool m_distributionVectorIsCurrent;
+    void startEpoch();
+    bool isUpdated(std::size_t index) const;
+};
+} // namespace aleatoric
+
+#endif /* ResettableDiscreteGenerator_hpp */
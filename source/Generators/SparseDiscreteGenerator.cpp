@@ -0,0 +1,200 @@
+#include "SparseDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+SparseDiscreteGenerator::SparseDiscreteGenerator()
+: SparseDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+SparseDiscreteGenerator::SparseDiscreteGenerator(
+    std::vector<double> distribution)
+: SparseDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+SparseDiscreteGenerator::SparseDiscreteGenerator(
+    std::vector<double> distribution,
+    std::uint64_t seed)
+: SparseDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+SparseDiscreteGenerator::SparseDiscreteGenerator(
+    std::shared_ptr<Engine> engine)
+: SparseDiscreteGenerator(std::vector<double> {1.0, 1.0}, std::move(engine))
+{}
+
+SparseDiscreteGenerator::SparseDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)),
+  m_size(0),
+  m_baseValue(0.0),
+  m_distributionVectorIsCurrent(false)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setDistributionVector(distribution);
+}
+
+SparseDiscreteGenerator::~SparseDiscreteGenerator()
+{}
+
+int SparseDiscreteGenerator::getNumber()
+{
+    if(m_size == 0) {
+        return 0;
+    }
+
+    double exceptionsTotal = 0.0;
+    for(auto &&exception : m_exceptions) {
+        exceptionsTotal += exception.second;
+    }
+
+    auto baseCount = m_size - m_exceptions.size();
+    auto baseTotal = m_baseValue * baseCount;
+    auto total = baseTotal + exceptionsTotal;
+    auto unitNumber = m_engine->getUnitNumber();
+
+    if(total <= 0.0) {
+        return static_cast<int>(unitNumber * m_size);
+    }
+
+    auto target = unitNumber * total;
+
+    // NB: rounding can put the target at the very top of the total
+    if(target < baseTotal || exceptionsTotal <= 0.0) {
+        // every index at the base weight is equally likely. The target gives
+        // the rank of the index among them, which is stepped past each
+        // exception at or below it (in ascending order) to find the index.
+        auto index = std::min(
+            static_cast<std::size_t>(target / baseTotal * baseCount),
+            baseCount - 1);
+        for(auto &&exception : m_exceptions) {
+            if(static_cast<std::size_t>(exception.first) > index) {
+                break;
+            }
+            index++;
+        }
+        return static_cast<int>(index);
+    }
+
+    target -= baseTotal;
+    int lastWeightedIndex = m_exceptions.begin()->first;
+
+    for(auto &&exception : m_exceptions) {
+        if(exception.second > 0.0) {
+            if(target < exception.second) {
+                return exception.first;
+            }
+            target -= exception.second;
+            lastWeightedIndex = exception.first;
+        }
+    }
+
+    return lastWeightedIndex;
+}
+
+void SparseDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = SparseDiscreteGenerator::getNumber();
+    }
+}
+
+void SparseDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    // NB: the base weight is the one shared by at least two of the first three
+    // items where there is one, so that a vector differing only at index 0
+    // (e.g. one saved by NoRepetition after it returned 0) stays sparse
+    auto baseValue = distributionVector.empty() ? 0.0 : distributionVector[0];
+    if(distributionVector.size() >= 3 &&
+       distributionVector[1] == distributionVector[2]) {
+        baseValue = distributionVector[1];
+    }
+
+    setDistributionVector(distributionVector.size(), baseValue);
+
+    for(size_t i = 0; i < distributionVector.size(); i++) {
+        if(distributionVector[i] != baseValue) {
+            m_exceptions[static_cast<int>(i)] = distributionVector[i];
+        }
+    }
+}
+
+void SparseDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                    double uniformValue)
+{
+    m_size = vectorSize;
+    updateDistributionVector(uniformValue);
+}
+
+void SparseDiscreteGenerator::updateDistributionVector(int index,
+                                                       double newValue)
+{
+    // NB: an index set back to the base weight is no longer an exception
+    if(newValue == m_baseValue) {
+        m_exceptions.erase(index);
+    } else {
+        m_exceptions[index] = newValue;
+    }
+    m_distributionVectorIsCurrent = false;
+}
+
+void SparseDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    m_baseValue = uniformValue;
+    m_exceptions.clear();
+    m_distributionVectorIsCurrent = false;
+}
+
+std::vector<double> SparseDiscreteGenerator::getDistributionVector()
+{
+    return viewDistributionVector();
+}
+
+const std::vector<double> &SparseDiscreteGenerator::viewDistributionVector()
+{
+    if(!m_distributionVectorIsCurrent) {
+        m_distributionVector.assign(m_size, m_baseValue);
+        for(auto &&exception : m_exceptions) {
+            m_distributionVector[exception.first] = exception.second;
+        }
+        m_distributionVectorIsCurrent = true;
+    }
+
+    return m_distributionVector;
+}
+
+std::size_t SparseDiscreteGenerator::getDistributionSize()
+{
+    return m_size;
+}
+
+std::size_t SparseDiscreteGenerator::getSupportSize()
+{
+    std::size_t weightedExceptions = 0;
+    for(auto &&exception : m_exceptions) {
+        if(exception.second > 0.0) {
+            weightedExceptions++;
+        }
+    }
+
+    if(m_baseValue <= 0.0) {
+        return weightedExceptions;
+    }
+
+    return m_size - m_exceptions.size() + weightedExceptions;
+}
+
+void SparseDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->advance(count * Engine::outputsPerUnitNumber);
+}
+} // namespace aleatoric
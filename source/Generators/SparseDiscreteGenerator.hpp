@@ -0,0 +1,104 @@
+#ifndef SparseDiscreteGenerator_hpp
+#define SparseDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution held as a base weight
+plus a few exceptions
+
+Every index has the base weight apart from the exceptions, which are held in a
+map from index to weight. Memory therefore depends on the number of exceptions
+k rather than on the size of the distribution, and a number is selected in
+O(k) time: the unit number either falls within the weight shared by the
+indices at the base weight, whose rank is then stepped past the exceptions
+below it, or within the weight of the exceptions, which are walked.
+
+This suits protocols whose weights are uniform bar one or two indices (e.g.
+Periodic and NoRepetition) over very large ranges, such as sample indices.
+Reading the distribution vector builds a dense copy, which takes O(n) time and
+memory, so the protocols read only its size (see getDistributionSize()). If
+every weight is zero, every index is equally likely.
+*/
+class SparseDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    SparseDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit SparseDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    SparseDiscreteGenerator(std::vector<double> distribution,
+                            std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit SparseDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    SparseDiscreteGenerator(std::vector<double> distribution,
+                            std::shared_ptr<Engine> engine);
+
+    ~SparseDiscreteGenerator();
+
+    int getNumber() override;
+
+    void getNumbers(int *output, std::size_t count) override;
+
+    /*! @brief sets the distribution. The value shared by at least two of the
+     * first three items (or else the first item) becomes the base weight, and
+     * the items that differ from it become exceptions. */
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    /*! @brief sets the size and the base weight, clearing the exceptions, in
+     * constant time */
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    /*! @brief sets the weight of a single index, in O(log k) time */
+    void updateDistributionVector(int index, double newValue) override;
+
+    /*! @brief sets the base weight, clearing the exceptions */
+    void updateDistributionVector(double uniformValue) override;
+
+    /*! @brief returns a dense copy of the distribution */
+    std::vector<double> getDistributionVector() override;
+
+    /*! @brief returns a dense copy of the distribution, which is built the
+     * first time it is read after a change */
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief returns the size of the distribution without building it */
+    std::size_t getDistributionSize() override;
+
+    /*! @brief returns the number of weights above zero, in O(k) time */
+    std::size_t getSupportSize() override;
+
+    /*! @brief skips the next count numbers by advancing the engine, as each
+     * number takes one unit number */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<Engine> m_engine;
+    std::size_t m_size;
+    double m_baseValue;
+    std::map<int, double> m_exceptions;
+    std::vector<double> m_distributionVector;
+    bool m_distributionVectorIsCurrent;
+};
+} // namespace aleatoric
+
+#endif /* SparseDiscreteGenerator_hpp */
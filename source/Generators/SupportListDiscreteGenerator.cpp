@@ -0,0 +1,215 @@
+#include "SupportListDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace aleatoric {
+SupportListDiscreteGenerator::SupportListDiscreteGenerator()
+: SupportListDiscreteGenerator(EngineRegistry::getThreadEngine())
+{}
+
+SupportListDiscreteGenerator::SupportListDiscreteGenerator(
+    std::vector<double> distribution)
+: SupportListDiscreteGenerator(distribution, EngineRegistry::getThreadEngine())
+{}
+
+SupportListDiscreteGenerator::SupportListDiscreteGenerator(
+    std::vector<double> distribution,
+    std::uint64_t seed)
+: SupportListDiscreteGenerator(distribution, std::make_shared<Engine>(seed))
+{}
+
+SupportListDiscreteGenerator::SupportListDiscreteGenerator(
+    std::shared_ptr<Engine> engine)
+: SupportListDiscreteGenerator(std::vector<double> {1.0, 1.0},
+                               std::move(engine))
+{}
+
+SupportListDiscreteGenerator::SupportListDiscreteGenerator(
+    std::vector<double> distribution,
+    std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)), m_distributionVector(distribution)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setSupport();
+}
+
+SupportListDiscreteGenerator::~SupportListDiscreteGenerator()
+{}
+
+int SupportListDiscreteGenerator::getNumber()
+{
+    if(m_distributionVector.empty()) {
+        return 0;
+    }
+
+    return selectIndex(m_engine->getUnitNumber());
+}
+
+void SupportListDiscreteGenerator::getNumbers(int *output, std::size_t count)
+{
+    if(m_distributionVector.empty()) {
+        std::fill(output, output + count, 0);
+        return;
+    }
+
+    double unitNumbers[Engine::bufferSize];
+
+    for(std::size_t done = 0; done < count; done += Engine::bufferSize) {
+        auto blockCount = std::min(Engine::bufferSize, count - done);
+        m_engine->generateUnitNumbers(unitNumbers, blockCount);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            output[done + i] = selectIndex(unitNumbers[i]);
+        }
+    }
+}
+
+void SupportListDiscreteGenerator::setDistributionVector(
+    std::vector<double> distributionVector)
+{
+    m_distributionVector = distributionVector;
+    setSupport();
+}
+
+void SupportListDiscreteGenerator::setDistributionVector(int vectorSize,
+                                                         double uniformValue)
+{
+    m_distributionVector.assign(vectorSize, uniformValue);
+    setSupport();
+}
+
+void SupportListDiscreteGenerator::updateDistributionVector(int index,
+                                                            double newValue)
+{
+    auto oldValue = m_distributionVector[index];
+    m_distributionVector[index] = newValue;
+
+    if(oldValue > 0.0) {
+        if(oldValue != m_commonWeight) {
+            m_differingWeights--;
+        }
+        if(newValue <= 0.0) {
+            removeFromSupport(index);
+        }
+    } else if(newValue > 0.0) {
+        addToSupport(index);
+    }
+
+    if(newValue > 0.0 && newValue != m_commonWeight) {
+        m_differingWeights++;
+    }
+
+    // NB: a lone weight in the support becomes the common weight, so that
+    // filling an empty support starts from equal weights again
+    if(m_support.size() == 1) {
+        m_commonWeight = m_distributionVector[m_support.front()];
+        m_differingWeights = 0;
+    }
+}
+
+void SupportListDiscreteGenerator::updateDistributionVector(double uniformValue)
+{
+    for(auto &&i : m_distributionVector) {
+        i = uniformValue;
+    }
+    setSupport();
+}
+
+std::vector<double> SupportListDiscreteGenerator::getDistributionVector()
+{
+    return m_distributionVector;
+}
+
+const std::vector<double> &
+SupportListDiscreteGenerator::viewDistributionVector()
+{
+    return m_distributionVector;
+}
+
+std::size_t SupportListDiscreteGenerator::getSupportSize()
+{
+    return m_support.size();
+}
+
+void SupportListDiscreteGenerator::discard(std::uint64_t count)
+{
+    m_engine->advance(count * Engine::outputsPerUnitNumber);
+}
+
+// Private methods
+void SupportListDiscreteGenerator::setSupport()
+{
+    m_support.clear();
+    m_supportPositions.resize(m_distributionVector.size());
+    m_commonWeight = 0.0;
+    m_differingWeights = 0;
+
+    for(size_t i = 0; i < m_distributionVector.size(); i++) {
+        auto weight = m_distributionVector[i];
+        if(weight <= 0.0) {
+            continue;
+        }
+
+        if(m_support.empty()) {
+            m_commonWeight = weight;
+        } else if(weight != m_commonWeight) {
+            m_differingWeights++;
+        }
+        addToSupport(static_cast<int>(i));
+    }
+}
+
+void SupportListDiscreteGenerator::addToSupport(int index)
+{
+    m_supportPositions[index] = m_support.size();
+    m_support.push_back(index);
+}
+
+void SupportListDiscreteGenerator::removeFromSupport(int index)
+{
+    auto position = m_supportPositions[index];
+    auto lastIndex = m_support.back();
+
+    m_support[position] = lastIndex;
+    m_supportPositions[lastIndex] = position;
+    m_support.pop_back();
+}
+
+int SupportListDiscreteGenerator::selectIndex(double unitNumber) const
+{
+    auto supportSize = m_support.size();
+
+    if(supportSize == 0) {
+        return static_cast<int>(unitNumber * m_distributionVector.size());
+    }
+
+    // NB: a unit number below 1 scaled by the size stays below the size
+    if(m_differingWeights == 0) {
+        return m_support[static_cast<std::size_t>(unitNumber * supportSize)];
+    }
+
+    double total = 0.0;
+    for(auto &&index : m_support) {
+        total += m_distributionVector[index];
+    }
+
+    auto target = unitNumber * total;
+    for(auto &&index : m_support) {
+        auto weight = m_distributionVector[index];
+        if(target < weight) {
+            return index;
+        }
+        target -= weight;
+    }
+
+    // NB: rounding can put the target at the very top of the total
+    return m_support.back();
+}
+} // namespace aleatoric
@@ -0,0 +1,102 @@
+#ifndef SupportListDiscreteGenerator_hpp
+#define SupportListDiscreteGenerator_hpp
+
+#include "IDiscreteGenerator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace aleatoric {
+class Engine;
+/*!
+@brief Generates numbers from a discrete distribution whose weights are driven
+to zero one at a time
+
+The indices with a weight above zero (the support) are held in a compact list,
+alongside the position of each index within it. Zeroing a weight swaps its
+index with the last in the list and removes it, and giving a zero weight a
+value appends its index, so single weight updates take constant time.
+
+While every weight in the support has the same value, a number is selected in
+constant time by indexing the list with one unit number, however few indices
+remain. This suits the protocols built on the SeriesPrinciple (e.g. Serial
+and Ratio), which start each series with equal weights and zero each number
+as it is selected. DiscreteGenerator rebuilds its distribution after every
+update and FenwickDiscreteGenerator takes O(log n) time. Once the weights in
+the support differ, a number takes O(k) time, where k is the size of the
+support. If every weight is zero, every index is equally likely.
+*/
+class SupportListDiscreteGenerator : public IDiscreteGenerator {
+  public:
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from the engine of the calling thread (see EngineRegistry) */
+    SupportListDiscreteGenerator();
+
+    /*! @brief Creates a generator with the distribution given, drawing from
+     * the engine of the calling thread */
+    explicit SupportListDiscreteGenerator(std::vector<double> distribution);
+
+    /*! @brief Creates a generator with the distribution given and a seeded
+     * engine of its own */
+    SupportListDiscreteGenerator(std::vector<double> distribution,
+                                 std::uint64_t seed);
+
+    /*! @brief Creates a generator with a distribution of {1.0, 1.0}, drawing
+     * from an engine that may be shared with other generators. The engine
+     * must not be null. */
+    explicit SupportListDiscreteGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Creates a generator with the distribution given, drawing from a
+     * shared engine. The engine must not be null. */
+    SupportListDiscreteGenerator(std::vector<double> distribution,
+                                 std::shared_ptr<Engine> engine);
+
+    ~SupportListDiscreteGenerator();
+
+    int getNumber() override;
+
+    /*! @brief writes count numbers to output, generating the unit numbers
+     * they take a block at a time */
+    void getNumbers(int *output, std::size_t count) override;
+
+    void setDistributionVector(std::vector<double> distributionVector) override;
+
+    void setDistributionVector(int vectorSize, double uniformValue) override;
+
+    /*! @brief updates a single weight in constant time */
+    void updateDistributionVector(int index, double newValue) override;
+
+    void updateDistributionVector(double uniformValue) override;
+
+    std::vector<double> getDistributionVector() override;
+
+    const std::vector<double> &viewDistributionVector() override;
+
+    /*! @brief returns the size of the support list, in constant time */
+    std::size_t getSupportSize() override;
+
+    /*! @brief skips the next count numbers by advancing the engine, as each
+     * number takes one unit number */
+    void discard(std::uint64_t count) override;
+
+  private:
+    std::shared_ptr<Engine> m_engine;
+    std::vector<double> m_distributionVector;
+    std::vector<int> m_support;
+    // NB: the position of each index in m_support, valid only for indices
+    // with a weight above zero
+    std::vector<std::size_t> m_supportPositions;
+    // The value shared by the weights in the support, and the number of
+    // weights in the support that differ from it
+    double m_commonWeight;
+    std::size_t m_differingWeights;
+    void setSupport();
+    void addToSupport(int index);
+    void removeFromSupport(int index);
+    int selectIndex(double unitNumber) const;
+};
+} // namespace aleatoric
+
+#endif /* SupportListDiscreteGenerator_hpp */
@@ -1,26 +1,149 @@
 #include "UniformGenerator.hpp"
 
 #include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
 
 namespace aleatoric {
+namespace {
+// NB: a range covering every int has 2^32 values, which wraps to 0: the bound
+// Engine::getBoundedNumber takes to mean 2^32
+std::uint32_t getRangeSize(int rangeStart, int rangeEnd)
+{
+    return static_cast<std::uint32_t>(rangeEnd) -
+           static_cast<std::uint32_t>(rangeStart) + 1u;
+}
+
+int offsetInRange(int rangeStart, std::uint32_t offset)
+{
+    return static_cast<int>(static_cast<std::int64_t>(rangeStart) + offset);
+}
+
+// The number of engine outputs Engine::getBoundedNumber rejects for a range
+// size: (2^32 - rangeSize) % rangeSize
+std::uint32_t getRejectionThreshold(std::uint32_t rangeSize)
+{
+    return rangeSize == 0 ? 0 : (0u - rangeSize) % rangeSize;
+}
+} // namespace
+
 UniformGenerator::UniformGenerator()
-: m_engine(std::make_unique<Engine>()), m_distribution(0, 1)
+: UniformGenerator(0, 1, EngineRegistry::getThreadEngine())
 {}
 
 UniformGenerator::UniformGenerator(int rangeStart, int rangeEnd)
-: m_engine(std::make_unique<Engine>()), m_distribution(rangeStart, rangeEnd)
+: UniformGenerator(rangeStart, rangeEnd, EngineRegistry::getThreadEngine())
 {}
 
+UniformGenerator::UniformGenerator(std::uint64_t seed)
+: UniformGenerator(0, 1, std::make_shared<Engine>(seed))
+{}
+
+UniformGenerator::UniformGenerator(int rangeStart,
+                                   int rangeEnd,
+                                   std::uint64_t seed)
+: UniformGenerator(rangeStart, rangeEnd, std::make_shared<Engine>(seed))
+{}
+
+UniformGenerator::UniformGenerator(std::shared_ptr<Engine> engine)
+: UniformGenerator(0, 1, std::move(engine))
+{}
+
+UniformGenerator::UniformGenerator(int rangeStart,
+                                   int rangeEnd,
+                                   std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine))
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    setDistribution(rangeStart, rangeEnd);
+}
+
 UniformGenerator::~UniformGenerator()
 {}
 
 int UniformGenerator::getNumber()
 {
-    return m_distribution(m_engine->getEngine());
+    return offsetInRange(m_rangeStart, m_engine->getBoundedNumber(m_rangeSize));
+}
+
+int UniformGenerator::getNumber(int rangeStart, int rangeEnd)
+{
+    return offsetInRange(
+        rangeStart,
+        m_engine->getBoundedNumber(getRangeSize(rangeStart, rangeEnd)));
+}
+
+void UniformGenerator::getNumbers(int *output, std::size_t count)
+{
+    auto threshold = getRejectionThreshold(m_rangeSize);
+
+    // NB: as in discard(), outputs are generated a block at a time, at most
+    // one for each number still to return, and a rejected output is replaced
+    // by the next, so the numbers match those of getNumber()
+    Engine::result_type block[Engine::bufferSize];
+    std::size_t done = 0;
+
+    while(done < count) {
+        auto blockCount = std::min(count - done, Engine::bufferSize);
+        m_engine->generate(block, blockCount);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            // as Engine::getBoundedNumber, which uses the low 32 bits
+            auto bits = static_cast<std::uint32_t>(block[i]);
+
+            if(m_rangeSize == 0) {
+                output[done++] = offsetInRange(m_rangeStart, bits);
+                continue;
+            }
+
+            auto product = static_cast<std::uint64_t>(bits) * m_rangeSize;
+            if(static_cast<std::uint32_t>(product) >= threshold) {
+                output[done++] = offsetInRange(
+                    m_rangeStart,
+                    static_cast<std::uint32_t>(product >> 32));
+            }
+        }
+    }
 }
 
 void UniformGenerator::setDistribution(int startRange, int endRange)
 {
-    m_distribution = std::uniform_int_distribution<int>(startRange, endRange);
+    m_rangeStart = startRange;
+    m_rangeSize = getRangeSize(startRange, endRange);
+}
+
+void UniformGenerator::discard(std::uint64_t count)
+{
+    auto threshold = getRejectionThreshold(m_rangeSize);
+
+    if(threshold == 0) {
+        m_engine->advance(count);
+        return;
+    }
+
+    // NB: at most one output is generated for each number still to skip, so
+    // the engine is never moved past the last of them
+    Engine::result_type block[Engine::bufferSize];
+
+    while(count > 0) {
+        auto blockCount = static_cast<std::size_t>(
+            std::min<std::uint64_t>(count, Engine::bufferSize));
+        m_engine->generate(block, blockCount);
+
+        for(std::size_t i = 0; i < blockCount; i++) {
+            // as Engine::getBoundedNumber, which uses the low 32 bits
+            auto product = static_cast<std::uint64_t>(
+                               static_cast<std::uint32_t>(block[i])) *
+                           m_rangeSize;
+            if(static_cast<std::uint32_t>(product) >= threshold) {
+                count--;
+            }
+        }
+    }
 }
 } // namespace aleatoric
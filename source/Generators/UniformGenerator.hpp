@@ -3,8 +3,9 @@
 
 #include "IUniformGenerator.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <random>
 
 namespace aleatoric {
 class Engine;
@@ -16,7 +17,9 @@ Uses a [Permuted Congruential Generator -
 PCG](https://github.com/imneme/pcg-cpp) engine through which to produce random
 numbers according to a uniform distribution.
 
-The uniform distribution is realised with __std::uniform_int_distribution__
+Numbers are mapped onto the range with Engine::getBoundedNumber rather than a
+__std::uniform_int_distribution__, so setting the range is two stores and the
+range can also be given per call.
 */
 class UniformGenerator : public IUniformGenerator {
   public:
@@ -45,12 +48,56 @@ class UniformGenerator : public IUniformGenerator {
      */
     UniformGenerator(int rangeStart, int rangeEnd);
 
+    /*!
+     * @brief Seeded equivalent of the default constructor
+     *
+     * Generators constructed with the same seed and range produce identical
+     * sequences. The constructors without a seed or an engine draw from the
+     * engine of the calling thread (see EngineRegistry).
+     *
+     * @param seed seed for the underlying engine
+     */
+    explicit UniformGenerator(std::uint64_t seed);
+
+    /*! @brief Seeded equivalent of UniformGenerator(int, int) */
+    UniformGenerator(int rangeStart, int rangeEnd, std::uint64_t seed);
+
+    /*!
+     * @brief Constructor taking an engine that may be shared with other
+     * generators
+     *
+     * Numbers are drawn from the engine supplied rather than from one owned
+     * by this generator. Generators sharing an engine interleave their draws
+     * on the same sequence.
+     *
+     * @param engine engine to draw from. Must not be null.
+     */
+    explicit UniformGenerator(std::shared_ptr<Engine> engine);
+
+    /*! @brief Equivalent of UniformGenerator(int, int) drawing from a shared
+     * engine */
+    UniformGenerator(int rangeStart,
+                     int rangeEnd,
+                     std::shared_ptr<Engine> engine);
+
     ~UniformGenerator();
 
     /*! @brief returns random numbers filtered through the uniform distribution
      */
     int getNumber() override;
 
+    /*!
+     * @brief returns a random number from the range given (inclusive),
+     * without changing the range set by setDistribution()
+     *
+     * Suits callers whose range changes from one number to the next.
+     */
+    int getNumber(int rangeStart, int rangeEnd) override;
+
+    /*! @brief writes count numbers to output, generating the engine outputs
+     * they take a block at a time (see Engine::generate()) */
+    void getNumbers(int *output, std::size_t count) override;
+
     /*!
     @brief sets the range of the uniform distribution. The range is inclusive.
 
@@ -59,9 +106,21 @@ class UniformGenerator : public IUniformGenerator {
     */
     void setDistribution(int rangeStart, int rangeEnd) override;
 
+    /*!
+     * @brief skips the next count numbers from the range set by
+     * setDistribution()
+     *
+     * When the size of the range is a power of two no engine outputs are
+     * rejected, so the engine is advanced over count outputs in O(log count)
+     * time. Otherwise the outputs are generated in bulk and the rejected ones
+     * counted, so the skip is exact without mapping each number to the range.
+     */
+    void discard(std::uint64_t count) override;
+
   private:
-    std::unique_ptr<Engine> m_engine;
-    std::uniform_int_distribution<int> m_distribution;
+    std::shared_ptr<Engine> m_engine;
+    int m_rangeStart;
+    std::uint32_t m_rangeSize;
 };
 } // namespace aleatoric
 
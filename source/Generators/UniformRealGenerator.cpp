@@ -1,33 +1,72 @@
 #include "UniformRealGenerator.hpp"
 
 #include "Engine.hpp"
+#include "EngineRegistry.hpp"
+
+#include <stdexcept>
 
 namespace aleatoric {
 UniformRealGenerator::UniformRealGenerator()
-: m_engine(std::make_unique<Engine>()),
-  m_distribution(0.0, 1.0),
-  m_range(0.0, 1.0)
+: UniformRealGenerator(0.0, 1.0, EngineRegistry::getThreadEngine())
 {}
 
 UniformRealGenerator::UniformRealGenerator(double rangeStart, double rangeEnd)
-: m_engine(std::make_unique<Engine>()),
-  m_distribution(rangeStart, rangeEnd),
-  m_range(rangeStart, rangeEnd)
+: UniformRealGenerator(rangeStart, rangeEnd, EngineRegistry::getThreadEngine())
+{}
+
+UniformRealGenerator::UniformRealGenerator(std::uint64_t seed)
+: UniformRealGenerator(0.0, 1.0, std::make_shared<Engine>(seed))
+{}
+
+UniformRealGenerator::UniformRealGenerator(double rangeStart,
+                                           double rangeEnd,
+                                           std::uint64_t seed)
+: UniformRealGenerator(rangeStart, rangeEnd, std::make_shared<Engine>(seed))
 {}
 
+UniformRealGenerator::UniformRealGenerator(std::shared_ptr<Engine> engine)
+: UniformRealGenerator(0.0, 1.0, std::move(engine))
+{}
+
+UniformRealGenerator::UniformRealGenerator(double rangeStart,
+                                           double rangeEnd,
+                                           std::shared_ptr<Engine> engine)
+: m_engine(std::move(engine)), m_range(rangeStart, rangeEnd)
+{
+    if(!m_engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+}
+
 UniformRealGenerator::~UniformRealGenerator()
 {}
 
 double UniformRealGenerator::getNumber()
 {
-    return m_distribution(m_engine->getEngine());
+    return getNumber(m_range.first, m_range.second);
+}
+
+double UniformRealGenerator::getNumber(double rangeStart, double rangeEnd)
+{
+    return rangeStart + (rangeEnd - rangeStart) * m_engine->getUnitNumber();
+}
+
+void UniformRealGenerator::fill(double *output,
+                                std::size_t count,
+                                double rangeStart,
+                                double rangeEnd)
+{
+    m_engine->generateUnitNumbers(output, count);
+
+    auto rangeSize = rangeEnd - rangeStart;
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = rangeStart + rangeSize * output[i];
+    }
 }
 
 void UniformRealGenerator::setDistribution(double rangeStart, double rangeEnd)
 {
     m_range = std::make_pair(rangeStart, rangeEnd);
-    m_distribution =
-        std::uniform_real_distribution<double>(rangeStart, rangeEnd);
 }
 
 std::pair<double, double> UniformRealGenerator::getDistribution()
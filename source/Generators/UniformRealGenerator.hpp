@@ -1,24 +1,56 @@
 #ifndef UniformRealGenerator_hpp
 #define UniformRealGenerator_hpp
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <random>
+#include <utility>
 
 namespace aleatoric {
 class Engine;
+/*!
+@brief Generates real numbers from a uniform distribution over a range
+
+Numbers are made directly from the raw bits of the engine (see
+Engine::getUnitNumber) and scaled to the range, so setting the range is cheap
+and the range can also be given per call.
+*/
 class UniformRealGenerator {
   public:
     UniformRealGenerator();
     UniformRealGenerator(double rangeStart, double rangeEnd);
+    explicit UniformRealGenerator(std::uint64_t seed);
+    UniformRealGenerator(double rangeStart,
+                         double rangeEnd,
+                         std::uint64_t seed);
+    explicit UniformRealGenerator(std::shared_ptr<Engine> engine);
+    UniformRealGenerator(double rangeStart,
+                         double rangeEnd,
+                         std::shared_ptr<Engine> engine);
     ~UniformRealGenerator();
 
     double getNumber();
+
+    /*! @brief returns a number from the range given, without changing the
+     * range set by setDistribution() */
+    double getNumber(double rangeStart, double rangeEnd);
+
+    /*!
+     * @brief Writes count numbers from the range given to output
+     *
+     * Equivalent to calling getNumber(rangeStart, rangeEnd) count times, but
+     * the engine generates the raw bits in bulk.
+     */
+    void fill(double *output,
+              std::size_t count,
+              double rangeStart,
+              double rangeEnd);
+
     void setDistribution(double rangeStart, double rangeEnd);
     std::pair<double, double> getDistribution();
 
   private:
-    std::unique_ptr<Engine> m_engine;
-    std::uniform_real_distribution<double> m_distribution;
+    std::shared_ptr<Engine> m_engine;
     std::pair<double, double> m_range;
 };
 } // namespace aleatoric
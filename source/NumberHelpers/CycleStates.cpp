@@ -14,6 +14,19 @@ int UniForward::getPosition(int &nextPosition, const Range &range)
     return nextPosition++;
 }
 
+int UniForward::skipPositions(int &nextPosition,
+                              const Range &range,
+                              std::uint64_t count)
+{
+    std::int64_t size = static_cast<std::int64_t>(range.end) - range.start + 1;
+    std::int64_t offset = static_cast<std::int64_t>(nextPosition) - range.start;
+    std::int64_t lastOffset = (offset + (count - 1) % size) % size;
+
+    int lastPosition = static_cast<int>(range.start + lastOffset);
+    nextPosition = lastPosition == range.end ? range.start : lastPosition + 1;
+    return lastPosition;
+}
+
 void UniForward::setRange(const int &lastPosition,
                           int &nextPosition,
                           const Range &range,
@@ -27,6 +40,11 @@ void UniForward::setRange(const int &lastPosition,
     }
 }
 
+bool UniForward::isReversed() const
+{
+    return false;
+}
+
 UniReverse::UniReverse()
 {}
 int UniReverse::getPosition(int &nextPosition, const Range &range)
@@ -40,6 +58,19 @@ int UniReverse::getPosition(int &nextPosition, const Range &range)
     return nextPosition--;
 }
 
+int UniReverse::skipPositions(int &nextPosition,
+                              const Range &range,
+                              std::uint64_t count)
+{
+    std::int64_t size = static_cast<std::int64_t>(range.end) - range.start + 1;
+    std::int64_t offset = static_cast<std::int64_t>(range.end) - nextPosition;
+    std::int64_t lastOffset = (offset + (count - 1) % size) % size;
+
+    int lastPosition = static_cast<int>(range.end - lastOffset);
+    nextPosition = lastPosition == range.start ? range.end : lastPosition - 1;
+    return lastPosition;
+}
+
 void UniReverse::setRange(const int &lastPosition,
                           int &nextPosition,
                           const Range &range,
@@ -53,6 +84,11 @@ void UniReverse::setRange(const int &lastPosition,
     }
 }
 
+bool UniReverse::isReversed() const
+{
+    return true;
+}
+
 Bidirectional::Bidirectional(bool initialStateReverse)
 : m_reverse(initialStateReverse)
 {}
@@ -72,6 +108,31 @@ int Bidirectional::getPosition(int &nextPosition, const Range &range)
     return m_reverse ? nextPosition-- : nextPosition++;
 }
 
+int Bidirectional::skipPositions(int &nextPosition,
+                                 const Range &range,
+                                 std::uint64_t count)
+{
+    // A full cycle, out from the start and back, is 2 * (size - 1) positions.
+    // Phases 0 to size - 1 are forwards and the rest in reverse.
+    std::int64_t turn = static_cast<std::int64_t>(range.end) - range.start;
+    std::int64_t period = 2 * turn;
+    std::int64_t phase =
+        m_reverse ? turn + (static_cast<std::int64_t>(range.end) - nextPosition)
+                  : static_cast<std::int64_t>(nextPosition) - range.start;
+    std::int64_t lastPhase = (phase + (count - 1) % period) % period;
+    std::int64_t nextPhase = lastPhase + 1;
+
+    // NB: the end is reached going forwards and the start in reverse, as when
+    // stepping through with getPosition
+    m_reverse = nextPhase > turn;
+    nextPosition = static_cast<int>(m_reverse ? range.end - (nextPhase - turn)
+                                              : range.start + nextPhase);
+
+    return static_cast<int>(lastPhase <= turn
+                                ? range.start + lastPhase
+                                : range.end - (lastPhase - turn));
+}
+
 void Bidirectional::setRange(const int &lastPosition,
                              int &nextPosition,
                              const Range &range,
@@ -93,4 +154,9 @@ void Bidirectional::setRange(const int &lastPosition,
         nextPosition = m_reverse ? range.end : range.start;
     }
 }
+
+bool Bidirectional::isReversed() const
+{
+    return m_reverse;
+}
 } // namespace aleatoric
@@ -3,15 +3,23 @@
 
 #include "Range.hpp"
 
+#include <cstdint>
+
 namespace aleatoric {
 // Interface
 class CycleState {
   public:
     virtual int getPosition(int &nextPosition, const Range &range) = 0;
+    // equivalent to calling getPosition count (> 0) times, returning the last
+    // position, in constant time
+    virtual int skipPositions(int &nextPosition,
+                              const Range &range,
+                              std::uint64_t count) = 0;
     virtual void setRange(const int &lastPosition,
                           int &nextPosition,
                           const Range &range,
                           const bool &haveRequestedFirstNumber) = 0;
+    virtual bool isReversed() const = 0;
     virtual ~CycleState() = default;
 };
 
@@ -20,30 +28,42 @@ class UniForward : public CycleState {
   public:
     UniForward();
     int getPosition(int &nextPosition, const Range &range) override;
+    int skipPositions(int &nextPosition,
+                      const Range &range,
+                      std::uint64_t count) override;
     void setRange(const int &lastPosition,
                   int &nextPosition,
                   const Range &range,
                   const bool &haveRequestedFirstNumber) override;
+    bool isReversed() const override;
 };
 
 class UniReverse : public CycleState {
   public:
     UniReverse();
     int getPosition(int &nextPosition, const Range &range) override;
+    int skipPositions(int &nextPosition,
+                      const Range &range,
+                      std::uint64_t count) override;
     void setRange(const int &lastPosition,
                   int &nextPosition,
                   const Range &range,
                   const bool &haveRequestedFirstNumber) override;
+    bool isReversed() const override;
 };
 
 class Bidirectional : public CycleState {
   public:
     Bidirectional(bool initialStateReverse);
     int getPosition(int &nextPosition, const Range &range) override;
+    int skipPositions(int &nextPosition,
+                      const Range &range,
+                      std::uint64_t count) override;
     void setRange(const int &lastPosition,
                   int &nextPosition,
                   const Range &range,
                   const bool &haveRequestedFirstNumber) override;
+    bool isReversed() const override;
 
   private:
     bool m_reverse;
@@ -17,13 +17,7 @@ int SeriesPrinciple::getNumber(std::unique_ptr<IDiscreteGenerator> &generator)
 bool SeriesPrinciple::seriesIsComplete(
     std::unique_ptr<IDiscreteGenerator> &generator)
 {
-    auto distributionVector = generator->getDistributionVector();
-    for(auto &&item : distributionVector) {
-        if(item > 0.0) {
-            return false;
-        }
-    }
-    return true;
+    return generator->getSupportSize() == 0;
 }
 
 void SeriesPrinciple::resetSeries(
@@ -31,4 +25,46 @@ void SeriesPrinciple::resetSeries(
 {
     generator->updateDistributionVector(1.0);
 }
+
+std::uint64_t
+SeriesPrinciple::skipSeries(std::unique_ptr<IDiscreteGenerator> &generator,
+                            std::uint64_t count)
+{
+    return skip(generator,
+                count,
+                generator->getDistributionSize(),
+                generator->getSupportSize());
+}
+
+std::uint64_t SeriesPrinciple::skipCountedSeries(
+    std::unique_ptr<IDiscreteGenerator> &generator,
+    std::uint64_t count,
+    std::uint64_t seriesSize)
+{
+    const auto &distributionVector = generator->viewDistributionVector();
+    std::uint64_t numbersLeft = 0;
+    for(auto &&weight : distributionVector) {
+        numbersLeft += static_cast<std::uint64_t>(weight);
+    }
+
+    return skip(generator, count, seriesSize, numbersLeft);
+}
+
+// Private methods
+std::uint64_t
+SeriesPrinciple::skip(std::unique_ptr<IDiscreteGenerator> &generator,
+                      std::uint64_t count,
+                      std::uint64_t seriesSize,
+                      std::uint64_t numbersLeft)
+{
+    if(seriesSize == 0 || count < numbersLeft) {
+        return 0;
+    }
+
+    auto skipped =
+        numbersLeft + (count - numbersLeft) / seriesSize * seriesSize;
+    generator->discard(skipped);
+    generator->updateDistributionVector(0.0);
+    return skipped;
 }
+}
\ No newline at end of file
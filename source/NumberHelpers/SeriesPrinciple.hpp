@@ -3,6 +3,7 @@
 
 #include "IDiscreteGenerator.hpp"
 
+#include <cstdint>
 #include <memory>
 
 namespace aleatoric {
@@ -16,6 +17,28 @@ class SeriesPrinciple {
     bool seriesIsComplete(std::unique_ptr<IDiscreteGenerator> &generator);
 
     void resetSeries(std::unique_ptr<IDiscreteGenerator> &generator);
+
+    // Skips the numbers left in the current series and then as many whole
+    // series as fit in count, returning the number skipped. Which numbers
+    // were drawn does not matter as the series completes, so the generator
+    // discards them and is left with a complete series. Skips nothing if
+    // count is less than the numbers left.
+    std::uint64_t skipSeries(std::unique_ptr<IDiscreteGenerator> &generator,
+                             std::uint64_t count);
+
+    // As skipSeries, for a series in which each number is returned as many
+    // times as its weight (e.g. Ratio), so that the numbers left are the sum
+    // of the weights. seriesSize is the number of numbers in a whole series.
+    std::uint64_t
+    skipCountedSeries(std::unique_ptr<IDiscreteGenerator> &generator,
+                      std::uint64_t count,
+                      std::uint64_t seriesSize);
+
+  private:
+    std::uint64_t skip(std::unique_ptr<IDiscreteGenerator> &generator,
+                       std::uint64_t count,
+                       std::uint64_t seriesSize,
+                       std::uint64_t numbersLeft);
 };
 } // namespace aleatoric
 
@@ -58,9 +58,32 @@ NumberProtocolConfig AdjacentSteps::getParams()
                                 NumberProtocolParams(AdjacentStepsParams()));
 }
 
+NumberProtocolState AdjacentSteps::saveState()
+{
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber =
+        m_haveRequestedFirstNumber &&
+        m_range.numberIsInRange(m_lastReturnedNumber);
+    state.lastNumber =
+        state.haveRequestedFirstNumber ? m_lastReturnedNumber : 0;
+    state.distributions = {m_generator->getDistributionVector()};
+    return state;
+}
+
+void AdjacentSteps::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {m_generator->getDistributionSize()});
+    state.checkLastNumberIsInRange(m_range);
+
+    m_haveRequestedFirstNumber = state.haveRequestedFirstNumber;
+    m_lastReturnedNumber = static_cast<int>(state.lastNumber);
+    m_generator->setDistributionVector(state.distributions[0]);
+}
+
 void AdjacentSteps::prepareStepBasedDistribution(int number)
 {
     auto vectorIndex = number - m_range.offset;
+    DistributionUpdate update(*m_generator);
     m_generator->updateDistributionVector(0.0);
 
     if(number == m_range.start) {
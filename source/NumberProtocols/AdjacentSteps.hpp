@@ -70,6 +70,10 @@ class AdjacentSteps : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
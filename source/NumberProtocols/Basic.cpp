@@ -21,6 +21,11 @@ int Basic::getIntegerNumber()
     return m_generator->getNumber();
 }
 
+void Basic::getIntegerNumbers(int *output, std::size_t count)
+{
+    m_generator->getNumbers(output, count);
+}
+
 double Basic::getDecimalNumber()
 {
     return static_cast<double>(getIntegerNumber());
@@ -31,6 +36,22 @@ NumberProtocolConfig Basic::getParams()
     return NumberProtocolConfig(m_range, NumberProtocolParams(BasicParams()));
 }
 
+NumberProtocolState Basic::saveState()
+{
+    // NB: the numbers returned depend only on the params and the engine
+    return NumberProtocolState();
+}
+
+void Basic::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {});
+}
+
+void Basic::discard(std::uint64_t count)
+{
+    m_generator->discard(count);
+}
+
 void Basic::setParams(NumberProtocolConfig newParams)
 {
     m_range = newParams.getRange();
@@ -37,10 +37,21 @@ class Basic : public NumberProtocol {
     /*! @brief returns a random number */
     int getIntegerNumber() override;
 
+    /*! @brief writes count numbers to output, taken from the generator in one
+     * call */
+    void getIntegerNumbers(int *output, std::size_t count) override;
+
     double getDecimalNumber() override;
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
+    /*! @brief skips count numbers by discarding them from the generator */
+    void discard(std::uint64_t count) override;
+
     void setParams(NumberProtocolConfig newParams) override;
 
   private:
@@ -3,6 +3,8 @@
 #include "CycleStates.hpp"
 #include "ErrorChecker.hpp"
 
+#include <stdexcept>
+
 namespace aleatoric {
 Cycle::Cycle()
 : m_range(0, 1),
@@ -54,6 +56,46 @@ NumberProtocolConfig Cycle::getParams()
         NumberProtocolParams(CycleParams(m_bidirectional, m_reverseDirection)));
 }
 
+NumberProtocolState Cycle::saveState()
+{
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber = m_haveRequestedFirstNumber;
+    state.lastNumber = m_haveRequestedFirstNumber ? m_lastPosition : 0;
+    state.counters = {m_nextPosition, m_state->isReversed()};
+    return state;
+}
+
+void Cycle::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(2, {});
+
+    // NB: the cycle steps from the next position, so one outside the range
+    // would step outside it too
+    if(!m_range.numberIsInRange(state.counters[0])) {
+        throw std::invalid_argument(
+            "The state supplied does not match the protocol");
+    }
+
+    m_haveRequestedFirstNumber = state.haveRequestedFirstNumber;
+    m_lastPosition = static_cast<int>(state.lastNumber);
+    m_nextPosition = state.counters[0];
+
+    // only a bidirectional cycle changes direction as it goes
+    if(m_bidirectional) {
+        m_state = std::make_unique<Bidirectional>(state.counters[1] != 0);
+    }
+}
+
+void Cycle::discard(std::uint64_t count)
+{
+    if(count == 0) {
+        return;
+    }
+
+    m_lastPosition = m_state->skipPositions(m_nextPosition, m_range, count);
+    m_haveRequestedFirstNumber = true;
+}
+
 // Private methods
 void Cycle::setState()
 {
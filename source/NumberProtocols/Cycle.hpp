@@ -28,6 +28,14 @@ class Cycle : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
+    /*! @brief skips count numbers in constant time, as the position after
+     * them follows directly from the current position */
+    void discard(std::uint64_t count) override;
+
   private:
     Range m_range;
     bool m_bidirectional;
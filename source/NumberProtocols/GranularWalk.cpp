@@ -47,6 +47,25 @@ double GranularWalk::getDecimalNumber()
     return m_lastReturnedNumber;
 }
 
+void GranularWalk::fill(double *output, std::size_t count)
+{
+    // NB: each number is a step from the last, so only the unit draws can be
+    // made up front. Scaling them to each step matches getDecimalNumber().
+    m_generator->fill(output, count, 0.0, 1.0);
+
+    for(std::size_t i = 0; i < count; i++) {
+        auto stepRange = m_generator->getDistribution();
+        m_lastReturnedNumber =
+            stepRange.first + (stepRange.second - stepRange.first) * output[i];
+        setForNextStep();
+        output[i] = m_lastReturnedNumber;
+    }
+
+    if(count > 0) {
+        m_haveRequestedFirstNumber = true;
+    }
+}
+
 void GranularWalk::setParams(NumberProtocolConfig newParams)
 {
     auto granWalkParams = newParams.protocols.getGranularWalk();
@@ -67,6 +86,31 @@ NumberProtocolConfig GranularWalk::getParams()
         NumberProtocolParams(GranularWalkParams(m_deviationFactor)));
 }
 
+NumberProtocolState GranularWalk::saveState()
+{
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber =
+        m_haveRequestedFirstNumber &&
+        m_range.floatingPointIsInRange(m_lastReturnedNumber);
+    state.lastNumber =
+        state.haveRequestedFirstNumber ? m_lastReturnedNumber : 0.0;
+    return state;
+}
+
+void GranularWalk::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {});
+    state.checkLastNumberIsInRange(m_range);
+
+    m_haveRequestedFirstNumber = state.haveRequestedFirstNumber;
+    m_lastReturnedNumber = state.lastNumber;
+    m_generator->setDistribution(m_range.start, m_range.end);
+
+    if(m_haveRequestedFirstNumber) {
+        setForNextStep();
+    }
+}
+
 // Private methods=====================================================
 void GranularWalk::setForNextStep()
 {
@@ -98,7 +142,8 @@ void GranularWalk::setRange(Range newRange)
     m_range = newRange;
     m_generator->setDistribution(m_range.start, m_range.end);
 
-    if(m_range.floatingPointIsInRange(m_lastReturnedNumber)) {
+    if(m_haveRequestedFirstNumber &&
+       m_range.floatingPointIsInRange(m_lastReturnedNumber)) {
         setForNextStep();
     }
 }
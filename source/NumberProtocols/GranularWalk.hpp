@@ -6,6 +6,7 @@
 #include "Range.hpp"
 #include "UniformRealGenerator.hpp"
 
+#include <cstddef>
 #include <memory>
 
 namespace aleatoric {
@@ -104,10 +105,23 @@ class GranularWalk : public NumberProtocol {
      */
     double getDecimalNumber() override;
 
+    /*!
+     * @brief Writes the next count numbers of the walk to output
+     *
+     * Equivalent to calling getDecimalNumber() count times, but the random
+     * part of each step is generated in bulk, e.g. for a block of a control
+     * signal.
+     */
+    void fill(double *output, std::size_t count);
+
     void setParams(NumberProtocolConfig newParams) override;
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
   private:
     std::unique_ptr<UniformRealGenerator> m_generator;
     Range m_range;
@@ -2,6 +2,8 @@
 
 #include "SeriesPrinciple.hpp"
 
+#include <stdexcept>
+
 namespace aleatoric {
 GroupedRepetition::GroupedRepetition(
     std::unique_ptr<IDiscreteGenerator> numberGenerator,
@@ -78,12 +80,42 @@ NumberProtocolConfig GroupedRepetition::getParams()
         NumberProtocolParams(GroupedRepetitionParams(m_groupings)));
 }
 
+NumberProtocolState GroupedRepetition::saveState()
+{
+    NumberProtocolState state;
+    state.counters = {m_groupingCount, m_currentReturnableNumber};
+    state.distributions = {m_numberGenerator->getDistributionVector(),
+                           m_groupingGenerator->getDistributionVector()};
+    return state;
+}
+
+void GroupedRepetition::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(2,
+                       {m_numberGenerator->getDistributionSize(),
+                        m_groupingGenerator->getDistributionSize()});
+
+    // NB: the current number only matters while a grouping is under way
+    if(state.counters[0] < 0 ||
+       (state.counters[0] > 0 &&
+        !m_range.numberIsInRange(state.counters[1]))) {
+        throw std::invalid_argument(
+            "The state supplied does not match the protocol");
+    }
+
+    m_groupingCount = state.counters[0];
+    m_currentReturnableNumber = state.counters[1];
+    m_numberGenerator->setDistributionVector(state.distributions[0]);
+    m_groupingGenerator->setDistributionVector(state.distributions[1]);
+}
+
 // Private methods
 void GroupedRepetition::initialise()
 {
     m_numberGenerator->setDistributionVector(m_range.size, 1.0);
     m_groupingGenerator->setDistributionVector(m_groupings.size(), 1.0);
     m_groupingCount = 0;
+    m_currentReturnableNumber = 0;
 }
 
 } // namespace aleatoric
@@ -31,6 +31,10 @@ class GroupedRepetition : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_numberGenerator;
     std::unique_ptr<IDiscreteGenerator> m_groupingGenerator;
@@ -24,10 +24,13 @@ NoRepetition::~NoRepetition()
 int NoRepetition::getIntegerNumber()
 {
     auto generatedNumber = m_generator->getNumber();
-    // reset equal probability
-    m_generator->updateDistributionVector(1.0);
-    // disallow last selected number
-    m_generator->updateDistributionVector(generatedNumber, 0.0);
+    {
+        DistributionUpdate update(*m_generator);
+        // reset equal probability
+        m_generator->updateDistributionVector(1.0);
+        // disallow last selected number
+        m_generator->updateDistributionVector(generatedNumber, 0.0);
+    }
     m_lastNumberReturned = generatedNumber + m_range.offset;
     m_haveRequestedFirstNumber = true;
     return m_lastNumberReturned;
@@ -41,13 +44,16 @@ double NoRepetition::getDecimalNumber()
 void NoRepetition::setParams(NumberProtocolConfig newParams)
 {
     auto newRange = newParams.getRange();
-    m_generator->setDistributionVector(newRange.size, 1.0);
+    {
+        DistributionUpdate update(*m_generator);
+        m_generator->setDistributionVector(newRange.size, 1.0);
 
-    if(m_haveRequestedFirstNumber &&
-       newRange.numberIsInRange(m_lastNumberReturned)) {
-        m_generator->updateDistributionVector(m_lastNumberReturned -
-                                                  newRange.offset,
-                                              0.0);
+        if(m_haveRequestedFirstNumber &&
+           newRange.numberIsInRange(m_lastNumberReturned)) {
+            m_generator->updateDistributionVector(m_lastNumberReturned -
+                                                      newRange.offset,
+                                                  0.0);
+        }
     }
 
     m_range = newRange;
@@ -59,4 +65,26 @@ NumberProtocolConfig NoRepetition::getParams()
                                 NumberProtocolParams(NoRepetitionParams()));
 }
 
+NumberProtocolState NoRepetition::saveState()
+{
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber =
+        m_haveRequestedFirstNumber &&
+        m_range.numberIsInRange(m_lastNumberReturned);
+    state.lastNumber =
+        state.haveRequestedFirstNumber ? m_lastNumberReturned : 0;
+    state.distributions = {m_generator->getDistributionVector()};
+    return state;
+}
+
+void NoRepetition::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {m_generator->getDistributionSize()});
+    state.checkLastNumberIsInRange(m_range);
+
+    m_haveRequestedFirstNumber = state.haveRequestedFirstNumber;
+    m_lastNumberReturned = static_cast<int>(state.lastNumber);
+    m_generator->setDistributionVector(state.distributions[0]);
+}
+
 } // namespace aleatoric
@@ -58,6 +58,10 @@ class NoRepetition : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
@@ -1,60 +1,143 @@
 #include "NumberProtocol.hpp"
 
 #include "AdjacentSteps.hpp"
+#include "AliasDiscreteGenerator.hpp"
 #include "Basic.hpp"
+#include "CountedDiscreteGenerator.hpp"
+#include "CounterDiscreteGenerator.hpp"
+#include "CounterEngine.hpp"
+#include "CounterUniformGenerator.hpp"
 #include "Cycle.hpp"
-#include "DiscreteGenerator.hpp"
+#include "Engine.hpp"
+#include "EngineRegistry.hpp"
 #include "GranularWalk.hpp"
 #include "GroupedRepetition.hpp"
 #include "NoRepetition.hpp"
 #include "Periodic.hpp"
 #include "Precision.hpp"
 #include "Ratio.hpp"
+#include "ResettableDiscreteGenerator.hpp"
 #include "Serial.hpp"
+#include "SparseDiscreteGenerator.hpp"
 #include "Subset.hpp"
+#include "SupportListDiscreteGenerator.hpp"
 #include "UniformGenerator.hpp"
 #include "UniformRealGenerator.hpp"
 #include "Walk.hpp"
 
+#include <stdexcept>
+
 namespace aleatoric {
+namespace {
+// NB: enough for a piece to move between a handful of precision settings
+constexpr std::size_t precisionTableCacheCapacity = 8;
+} // namespace
+
+void NumberProtocol::getIntegerNumbers(int *output, std::size_t count)
+{
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] = getIntegerNumber();
+    }
+}
+
+void NumberProtocol::discard(std::uint64_t count)
+{
+    for(std::uint64_t i = 0; i < count; i++) {
+        getIntegerNumber();
+    }
+}
+
 std::unique_ptr<NumberProtocol> NumberProtocol::create(Type type)
 {
+    return create(type, EngineRegistry::getThreadEngine());
+}
+
+std::unique_ptr<NumberProtocol> NumberProtocol::create(Type type,
+                                                       std::uint64_t seed)
+{
+    return create(type, std::make_shared<Engine>(seed));
+}
+
+std::unique_ptr<NumberProtocol>
+NumberProtocol::create(Type type, std::shared_ptr<Engine> engine)
+{
+    // NB: checked here as Cycle has no generator to reject a null engine
+    if(!engine) {
+        throw std::invalid_argument("The engine supplied must not be null");
+    }
+
+    // NB: protocols holding two generators share the one engine between them.
+    // Protocols built on the SeriesPrinciple zero a weight after every number,
+    // which a SupportListDiscreteGenerator does (and samples what is left) in
+    // constant time. Protocols whose weights are uniform bar the last number's
+    // (NoRepetition and Periodic) use a SparseDiscreteGenerator, and
+    // AdjacentSteps, which resets every weight before each number, uses a
+    // ResettableDiscreteGenerator.
     switch(type) {
     case Type::adjacentSteps:
         return std::make_unique<AdjacentSteps>(
-            std::make_unique<DiscreteGenerator>());
+            std::make_unique<ResettableDiscreteGenerator>(engine));
     case Type::basic:
-        return std::make_unique<Basic>(std::make_unique<UniformGenerator>());
+        return std::make_unique<Basic>(
+            std::make_unique<UniformGenerator>(engine));
     case Type::cycle:
         return std::make_unique<Cycle>();
     case Type::granularWalk:
         return std::make_unique<GranularWalk>(
-            std::make_unique<UniformRealGenerator>());
+            std::make_unique<UniformRealGenerator>(engine));
     case Type::groupedRepetition:
         return std::make_unique<GroupedRepetition>(
-            std::make_unique<DiscreteGenerator>(),
-            std::make_unique<DiscreteGenerator>());
+            std::make_unique<SupportListDiscreteGenerator>(engine),
+            std::make_unique<SupportListDiscreteGenerator>(engine));
     case Type::noRepetition:
         return std::make_unique<NoRepetition>(
-            std::make_unique<DiscreteGenerator>());
+            std::make_unique<SparseDiscreteGenerator>(engine));
     case Type::periodic:
         return std::make_unique<Periodic>(
-            std::make_unique<DiscreteGenerator>());
-    case Type::precision:
-        return std::make_unique<Precision>(
-            std::make_unique<DiscreteGenerator>());
+            std::make_unique<SparseDiscreteGenerator>(engine));
+    case Type::precision: {
+        // NB: the distribution only changes with the params, so is sampled
+        // from an alias table, and the tables of recent params are kept
+        auto generator = std::make_unique<AliasDiscreteGenerator>(engine);
+        generator->setTableCacheCapacity(precisionTableCacheCapacity);
+        return std::make_unique<Precision>(std::move(generator));
+    }
     case Type::ratio:
-        return std::make_unique<Ratio>(std::make_unique<DiscreteGenerator>());
+        // NB: the weights are the counts still to be returned in the series
+        return std::make_unique<Ratio>(
+            std::make_unique<CountedDiscreteGenerator>(engine));
     case Type::serial:
-        return std::make_unique<Serial>(std::make_unique<DiscreteGenerator>());
+        return std::make_unique<Serial>(
+            std::make_unique<SupportListDiscreteGenerator>(engine));
     case Type::subset:
-        return std::make_unique<Subset>(std::make_unique<UniformGenerator>(),
-                                        std::make_unique<DiscreteGenerator>());
+        return std::make_unique<Subset>(
+            std::make_unique<UniformGenerator>(engine),
+            std::make_unique<SupportListDiscreteGenerator>(engine));
     case Type::walk:
-        return std::make_unique<Walk>(std::make_unique<UniformGenerator>());
+        return std::make_unique<Walk>(
+            std::make_unique<UniformGenerator>(engine));
 
     default:
         throw std::invalid_argument("Protocol type not recognised");
     }
 }
+
+std::unique_ptr<NumberProtocol>
+NumberProtocol::createCounterBased(Type type,
+                                   std::shared_ptr<CounterEngine> engine)
+{
+    switch(type) {
+    case Type::basic:
+        return std::make_unique<Basic>(
+            std::make_unique<CounterUniformGenerator>(engine));
+    case Type::precision:
+        return std::make_unique<Precision>(
+            std::make_unique<CounterDiscreteGenerator>(engine));
+
+    default:
+        throw std::invalid_argument(
+            "Only basic and precision protocols can draw from a counter "
+            "engine");
+    }
+}
 } // namespace aleatoric
@@ -2,12 +2,17 @@
 #define NumberProtocol_hpp
 
 // #include "NumberProtocolParameters.hpp"
+#include "NumberProtocolState.hpp"
 #include "Range.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace aleatoric {
 struct NumberProtocolConfig; // forward dec preventing circular dep
+class CounterEngine;
+class Engine;
 
 /*! @brief Interface to which concrete protocol classes that produce random
  * numbers must conform
@@ -23,12 +28,42 @@ class NumberProtocol {
     /*! Pure virtual method for getting random numbers from a protocol */
     virtual int getIntegerNumber() = 0;
 
+    /*!
+     * @brief Writes the next count numbers to output, as if
+     * getIntegerNumber() had been called count times
+     *
+     * The default calls getIntegerNumber() count times. Stateless protocols
+     * override it to take the whole batch from their generator in one call.
+     */
+    virtual void getIntegerNumbers(int *output, std::size_t count);
+
     virtual double getDecimalNumber() = 0;
 
     virtual void setParams(NumberProtocolConfig newParams) = 0;
 
     virtual NumberProtocolConfig getParams() = 0;
 
+    /*! @brief Returns the internal state of the protocol, i.e. everything
+     * other than its params and its engine that determines the numbers it
+     * will return next */
+    virtual NumberProtocolState saveState() = 0;
+
+    /*! @brief Returns the protocol to a state returned by saveState. The
+     * protocol must have the same params as the one that saved the state.
+     * Throws std::invalid_argument if the state does not match the
+     * protocol. */
+    virtual void restoreState(NumberProtocolState state) = 0;
+
+    /*!
+     * @brief Skips the next count numbers, leaving the protocol (and its
+     * engine) as if getIntegerNumber() had been called count times
+     *
+     * The default calls getIntegerNumber() count times. Protocols override it
+     * with the cheapest skip they can make, e.g. jumping the engine ahead
+     * when each number takes a known number of draws.
+     */
+    virtual void discard(std::uint64_t count);
+
     virtual ~NumberProtocol() = default;
 
     enum class Type {
@@ -47,7 +82,43 @@ class NumberProtocol {
         none
     };
 
+    /*! @brief Creates a protocol whose generators draw from the engine of the
+     * calling thread (see EngineRegistry) */
     static std::unique_ptr<NumberProtocol> create(Type type);
+
+    /*! @brief Creates a protocol whose generators are seeded
+     * deterministically. Protocols created with the same type and seed, and
+     * configured with the same params, produce identical output. */
+    static std::unique_ptr<NumberProtocol> create(Type type,
+                                                  std::uint64_t seed);
+
+    /*! @brief Creates a protocol whose generators all draw from the engine
+     * supplied. The engine can be shared with other protocols, e.g. one
+     * engine per voice. It must not be null, even for a cycle protocol, which
+     * draws nothing from it.
+     *
+     * NB: a precision protocol keeps the alias tables built for its most
+     * recently used distributions (see
+     * AliasDiscreteGenerator::setTableCacheCapacity), so that switching
+     * between a few sets of params does not rebuild them. */
+    static std::unique_ptr<NumberProtocol>
+    create(Type type, std::shared_ptr<Engine> engine);
+
+    /*!
+     * @brief Creates a protocol that draws from a counter engine
+     *
+     * Number n of the protocol is then a pure function of the engine key and
+     * n, and is returned next after calling setPosition(n) on the engine.
+     * This allows scrubbing to any point of a long sequence, and regenerating
+     * windows of it in parallel with engines sharing a key. Only the
+     * stateless protocols (basic and precision) are supported; other types
+     * throw std::invalid_argument. The engine must not be null.
+     *
+     * NB: named apart from create() so that create(type, nullptr) is not
+     * ambiguous.
+     */
+    static std::unique_ptr<NumberProtocol>
+    createCounterBased(Type type, std::shared_ptr<CounterEngine> engine);
 };
 } // namespace aleatoric
 
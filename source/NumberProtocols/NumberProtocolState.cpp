@@ -0,0 +1,95 @@
+#include "NumberProtocolState.hpp"
+
+#include "Range.hpp"
+
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace aleatoric {
+void NumberProtocolState::checkMatches(
+    std::size_t counterCount,
+    const std::vector<std::size_t> &distributionSizes) const
+{
+    bool matches = counters.size() == counterCount &&
+                   distributions.size() == distributionSizes.size();
+
+    for(size_t i = 0; matches && i < distributions.size(); i++) {
+        matches = distributions[i].size() == distributionSizes[i];
+    }
+
+    if(!matches) {
+        throw std::invalid_argument(
+            "The state supplied does not match the protocol");
+    }
+}
+
+void NumberProtocolState::checkLastNumberIsInRange(const Range &range) const
+{
+    if(haveRequestedFirstNumber && !range.floatingPointIsInRange(lastNumber)) {
+        throw std::invalid_argument(
+            "The state supplied does not match the protocol");
+    }
+}
+
+std::ostream &operator<<(std::ostream &out, const NumberProtocolState &state)
+{
+    // NB: full precision so that decimal numbers are restored exactly
+    auto flags = out.flags();
+    auto precision = out.precision(std::numeric_limits<double>::max_digits10);
+
+    out << state.haveRequestedFirstNumber << ' ' << state.lastNumber << ' '
+        << state.counters.size();
+    for(auto &&counter : state.counters) {
+        out << ' ' << counter;
+    }
+
+    out << ' ' << state.distributions.size();
+    for(auto &&distribution : state.distributions) {
+        out << ' ' << distribution.size();
+        for(auto &&weight : distribution) {
+            out << ' ' << weight;
+        }
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+std::istream &operator>>(std::istream &in, NumberProtocolState &state)
+{
+    NumberProtocolState newState;
+    std::size_t size = 0;
+
+    in >> newState.haveRequestedFirstNumber >> newState.lastNumber >> size;
+    for(size_t i = 0; in && i < size; i++) {
+        int counter;
+        in >> counter;
+        newState.counters.push_back(counter);
+    }
+
+    in >> size;
+    for(size_t i = 0; in && i < size; i++) {
+        std::size_t distributionSize = 0;
+        in >> distributionSize;
+
+        std::vector<double> distribution;
+        for(size_t ii = 0; in && ii < distributionSize; ii++) {
+            double weight;
+            in >> weight;
+            distribution.push_back(weight);
+        }
+        newState.distributions.push_back(distribution);
+    }
+
+    // leave the state untouched if it could not be read
+    if(in) {
+        state = newState;
+    }
+
+    return in;
+}
+} // namespace aleatoric
@@ -0,0 +1,66 @@
+#ifndef NumberProtocolState_hpp
+#define NumberProtocolState_hpp
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace aleatoric {
+struct Range;
+
+/*!
+ * @brief The internal state of a protocol at a point in its output
+ *
+ * Returned by NumberProtocol::saveState and passed to
+ * NumberProtocol::restoreState. A state only makes sense to a protocol of the
+ * same type and params as the one that saved it. Together with the state of
+ * the engine the protocol draws from (see Engine::saveState), it allows a long
+ * render to be checkpointed and resumed without replaying the draws that led
+ * up to it.
+ *
+ * A state can be written to and read from a stream with the << and >>
+ * operators.
+ */
+struct NumberProtocolState {
+    /*! @brief whether the protocol has returned a number since it was
+     * constructed */
+    bool haveRequestedFirstNumber = false;
+
+    /*! @brief the last number returned, for protocols whose next number
+     * depends on it. A last number that setParams() has left outside the
+     * range no longer affects the next number, so is saved as if no number
+     * had been returned. */
+    double lastNumber = 0.0;
+
+    /*! @brief protocol specific positions and counters, e.g. the position and
+     * direction of a Cycle */
+    std::vector<int> counters {};
+
+    /*! @brief the current weights of each of the protocol's discrete
+     * generators, e.g. the numbers remaining in a Serial series */
+    std::vector<std::vector<double>> distributions {};
+
+    /*!
+     * @brief Checks that the state has the shape expected by a protocol
+     *
+     * @throws std::invalid_argument if the number of counters does not match
+     * counterCount or the distributions do not match distributionSizes
+     */
+    void checkMatches(std::size_t counterCount,
+                      const std::vector<std::size_t> &distributionSizes) const;
+
+    /*!
+     * @brief Checks that the last number, if a number has been returned, is
+     * within the range of the protocol
+     *
+     * @throws std::invalid_argument if it is not
+     */
+    void checkLastNumberIsInRange(const Range &range) const;
+};
+
+std::ostream &operator<<(std::ostream &out, const NumberProtocolState &state);
+
+std::istream &operator>>(std::istream &in, NumberProtocolState &state);
+} // namespace aleatoric
+
+#endif /* NumberProtocolState_hpp */
@@ -53,6 +53,28 @@ NumberProtocolConfig Periodic::getParams()
         NumberProtocolParams(PeriodicParams(m_periodicity)));
 }
 
+NumberProtocolState Periodic::saveState()
+{
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber =
+        m_haveRequestedFirstNumber &&
+        m_range.numberIsInRange(m_lastReturnedNumber);
+    state.lastNumber =
+        state.haveRequestedFirstNumber ? m_lastReturnedNumber : 0;
+    state.distributions = {m_generator->getDistributionVector()};
+    return state;
+}
+
+void Periodic::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {m_generator->getDistributionSize()});
+    state.checkLastNumberIsInRange(m_range);
+
+    m_haveRequestedFirstNumber = state.haveRequestedFirstNumber;
+    m_lastReturnedNumber = static_cast<int>(state.lastNumber);
+    m_generator->setDistributionVector(state.distributions[0]);
+}
+
 void Periodic::setParams(NumberProtocolConfig params)
 {
     auto chanceOfRepetition =
@@ -72,9 +94,8 @@ void Periodic::setParams(NumberProtocolConfig params)
 }
 
 // Private methods
-double Periodic::calculateRemainerAllocation()
+double Periodic::calculateRemainerAllocation(size_t vectorSize)
 {
-    auto vectorSize = m_generator->getDistributionVector().size();
     return (1.0 - m_periodicity) / (vectorSize - 1.0);
 }
 
@@ -97,17 +118,14 @@ void Periodic::setPeriodicDistribution(int selectedIndex)
     // and
     // https://www.boost.org/doc/libs/1_63_0/libs/math/doc/html/math_toolkit/float_comparison.html
 
-    auto distributionVector = m_generator->getDistributionVector();
-    auto remainderAllocation = calculateRemainerAllocation();
-
-    for(size_t i = 0; i < distributionVector.size(); i++) {
-        auto newVectorValue = static_cast<int>(i) == selectedIndex
-                                  ? m_periodicity
-                                  : remainderAllocation;
-        distributionVector[i] = newVectorValue;
-    }
-
-    m_generator->setDistributionVector(distributionVector);
+    // NB: set as a uniform value plus the one differing index, so that a
+    // sparse generator need not be handed a dense vector
+    auto vectorSize = m_generator->getDistributionSize();
+    DistributionUpdate update(*m_generator);
+    m_generator->setDistributionVector(
+        static_cast<int>(vectorSize),
+        calculateRemainerAllocation(vectorSize));
+    m_generator->updateDistributionVector(selectedIndex, m_periodicity);
 }
 
 void Periodic::setRange(Range newRange)
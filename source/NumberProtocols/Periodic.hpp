@@ -87,12 +87,16 @@ class Periodic : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
     double m_periodicity;
     void setPeriodicDistribution(int selectedIndex);
-    double calculateRemainerAllocation();
+    double calculateRemainerAllocation(size_t vectorSize);
     void setRange(Range newRange);
     bool m_haveRequestedFirstNumber;
     int m_lastReturnedNumber;
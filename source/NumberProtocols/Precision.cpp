@@ -26,6 +26,15 @@ int Precision::getIntegerNumber()
     return m_generator->getNumber() + m_range.offset;
 }
 
+void Precision::getIntegerNumbers(int *output, std::size_t count)
+{
+    m_generator->getNumbers(output, count);
+
+    for(std::size_t i = 0; i < count; i++) {
+        output[i] += m_range.offset;
+    }
+}
+
 double Precision::getDecimalNumber()
 {
     return static_cast<double>(getIntegerNumber());
@@ -47,6 +56,23 @@ NumberProtocolConfig Precision::getParams()
                                     m_generator->getDistributionVector())));
 }
 
+NumberProtocolState Precision::saveState()
+{
+    // NB: the distribution is set entirely by the params, so the numbers
+    // returned depend only on the params and the engine
+    return NumberProtocolState();
+}
+
+void Precision::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {});
+}
+
+void Precision::discard(std::uint64_t count)
+{
+    m_generator->discard(count);
+}
+
 // Private methods
 void Precision::checkDistributionMatchesRange(
     const std::vector<double> &distribution, const Range &range)
@@ -18,12 +18,23 @@ class Precision : public NumberProtocol {
 
     int getIntegerNumber() override;
 
+    /*! @brief writes count numbers to output, taken from the generator in one
+     * call */
+    void getIntegerNumbers(int *output, std::size_t count) override;
+
     double getDecimalNumber() override;
 
     void setParams(NumberProtocolConfig newParams) override;
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
+    /*! @brief skips count numbers by discarding them from the generator */
+    void discard(std::uint64_t count) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
@@ -2,6 +2,7 @@
 
 #include "SeriesPrinciple.hpp"
 
+#include <numeric>
 #include <stdexcept>
 
 namespace aleatoric {
@@ -32,11 +33,13 @@ Ratio::~Ratio()
 int Ratio::getIntegerNumber()
 {
     if(m_seriesPrinciple->seriesIsComplete(m_generator)) {
-        m_seriesPrinciple->resetSeries(m_generator);
+        resetSeries();
     }
 
-    auto index = m_seriesPrinciple->getNumber(m_generator);
-    return m_selectables[index];
+    auto index = m_generator->getNumber();
+    auto remaining = m_generator->viewDistributionVector()[index];
+    m_generator->updateDistributionVector(index, remaining - 1.0);
+    return index + m_range.offset;
 }
 
 double Ratio::getDecimalNumber()
@@ -51,9 +54,7 @@ void Ratio::setParams(NumberProtocolConfig newParams)
     checkRangeAndRatiosMatch(newRange, newRatios);
     m_ratios = newRatios;
     m_range = newRange;
-    m_selectables.clear();
-    setSelectables();
-    m_generator->setDistributionVector(m_selectables.size(), 1.0);
+    resetSeries();
 }
 
 NumberProtocolConfig Ratio::getParams()
@@ -62,14 +63,34 @@ NumberProtocolConfig Ratio::getParams()
                                 NumberProtocolParams(RatioParams(m_ratios)));
 }
 
+NumberProtocolState Ratio::saveState()
+{
+    NumberProtocolState state;
+    state.distributions = {m_generator->getDistributionVector()};
+    return state;
+}
+
+void Ratio::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {m_generator->getDistributionSize()});
+    m_generator->setDistributionVector(state.distributions[0]);
+}
+
+void Ratio::discard(std::uint64_t count)
+{
+    std::uint64_t seriesSize =
+        std::accumulate(m_ratios.begin(), m_ratios.end(), std::uint64_t(0));
+    count -=
+        m_seriesPrinciple->skipCountedSeries(m_generator, count, seriesSize);
+
+    NumberProtocol::discard(count);
+}
+
 // Private methods
-void Ratio::setSelectables()
+void Ratio::resetSeries()
 {
-    for(size_t i = 0; i < m_ratios.size(); i++) {
-        for(int ii = 0; ii < m_ratios[i]; ii++) {
-            m_selectables.push_back(m_range.offset + i);
-        }
-    }
+    m_generator->setDistributionVector(
+        std::vector<double>(m_ratios.begin(), m_ratios.end()));
 }
 
 void Ratio::checkRangeAndRatiosMatch(const Range &range,
@@ -79,12 +100,27 @@ void Ratio::checkRangeAndRatiosMatch(const Range &range,
         throw std::invalid_argument(
             "The size of ratios collection must match the size of the range");
     }
+
+    // NB: checked before any member is changed, so that a rejected params
+    // leaves the protocol as it was
+    bool anyAboveZero = false;
+    for(auto &&ratio : ratios) {
+        if(ratio < 0) {
+            throw std::invalid_argument(
+                "The values of the ratios collection must be zero or more");
+        }
+        anyAboveZero = anyAboveZero || ratio > 0;
+    }
+
+    if(!anyAboveZero) {
+        throw std::invalid_argument(
+            "At least one value of the ratios collection must be above zero");
+    }
 }
 
 void Ratio::initialise()
 {
-    setSelectables();
-    m_generator->setDistributionVector(m_selectables.size(), 1.0);
+    resetSeries();
 }
 
 } // namespace aleatoric
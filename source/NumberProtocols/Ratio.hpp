@@ -11,6 +11,16 @@
 namespace aleatoric {
 class SeriesPrinciple;
 
+/*!
+ * @brief A protocol returning each number in the range as many times in a
+ * series as its ratio
+ *
+ * The generator's weights are the counts of each number still to be returned
+ * in the current series. Each number selected has its count reduced by one,
+ * and once every count is zero the counts are reset to the ratios. Memory and
+ * the cost of each number therefore depend on the size of the range rather
+ * than the sum of the ratios (see CountedDiscreteGenerator).
+ */
 class Ratio : public NumberProtocol {
   public:
     Ratio(std::unique_ptr<IDiscreteGenerator> generator);
@@ -29,13 +39,20 @@ class Ratio : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
+    /*! @brief skips count numbers, jumping over the rest of the current
+     * series and then whole series at once (see Serial::discard) */
+    void discard(std::uint64_t count) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
     std::vector<int> m_ratios;
-    std::vector<int> m_selectables;
     std::unique_ptr<SeriesPrinciple> m_seriesPrinciple;
-    void setSelectables();
+    void resetSeries();
     void checkRangeAndRatiosMatch(const Range &range,
                                   const std::vector<int> &ratios);
     void initialise();
@@ -48,4 +48,23 @@ NumberProtocolConfig Serial::getParams()
     return NumberProtocolConfig(m_range, NumberProtocolParams(SerialParams()));
 }
 
+NumberProtocolState Serial::saveState()
+{
+    NumberProtocolState state;
+    state.distributions = {m_generator->getDistributionVector()};
+    return state;
+}
+
+void Serial::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {m_generator->getDistributionSize()});
+    m_generator->setDistributionVector(state.distributions[0]);
+}
+
+void Serial::discard(std::uint64_t count)
+{
+    count -= m_seriesPrinciple->skipSeries(m_generator, count);
+    NumberProtocol::discard(count);
+}
+
 } // namespace aleatoric
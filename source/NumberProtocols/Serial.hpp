@@ -57,6 +57,15 @@ class Serial : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
+    /*! @brief skips count numbers, jumping over the rest of the current
+     * series and then whole series at once. Only the numbers of a final
+     * partial series are drawn. */
+    void discard(std::uint64_t count) override;
+
   private:
     std::unique_ptr<IDiscreteGenerator> m_generator;
     Range m_range;
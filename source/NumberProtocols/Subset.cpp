@@ -82,6 +82,42 @@ NumberProtocolConfig Subset::getParams()
         NumberProtocolParams(SubsetParams(m_subsetMin, m_subsetMax)));
 }
 
+NumberProtocolState Subset::saveState()
+{
+    NumberProtocolState state;
+    state.counters = m_subset;
+    state.distributions = {m_discreteGenerator->getDistributionVector()};
+    return state;
+}
+
+void Subset::restoreState(NumberProtocolState state)
+{
+    // the counters are the members of the subset
+    state.checkMatches(state.counters.size(),
+                       {m_discreteGenerator->getDistributionSize()});
+
+    bool subsetIsValid =
+        static_cast<int>(state.counters.size()) >= m_subsetMin &&
+        static_cast<int>(state.counters.size()) <= m_subsetMax;
+    for(auto &&i : state.counters) {
+        subsetIsValid = subsetIsValid && m_range.numberIsInRange(i);
+    }
+
+    if(!subsetIsValid) {
+        throw std::invalid_argument(
+            "The state supplied does not match the protocol");
+    }
+
+    m_subset = state.counters;
+    m_uniformGenerator->setDistribution(0, m_subset.size() - 1);
+    m_discreteGenerator->setDistributionVector(state.distributions[0]);
+}
+
+void Subset::discard(std::uint64_t count)
+{
+    m_uniformGenerator->discard(count);
+}
+
 // Private methods
 void Subset::setSubset()
 {
@@ -32,6 +32,14 @@ class Subset : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
+    /*! @brief skips count numbers by discarding them from the generator
+     * that selects from the subset */
+    void discard(std::uint64_t count) override;
+
   private:
     std::unique_ptr<IUniformGenerator> m_uniformGenerator;
     std::unique_ptr<IDiscreteGenerator> m_discreteGenerator;
@@ -64,6 +64,31 @@ NumberProtocolConfig Walk::getParams()
                                 NumberProtocolParams(WalkParams(m_maxStep)));
 }
 
+NumberProtocolState Walk::saveState()
+{
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber =
+        m_haveRequestedFirstNumber &&
+        m_range.numberIsInRange(m_lastNumberSelected);
+    state.lastNumber =
+        state.haveRequestedFirstNumber ? m_lastNumberSelected : 0;
+    return state;
+}
+
+void Walk::restoreState(NumberProtocolState state)
+{
+    state.checkMatches(0, {});
+    state.checkLastNumberIsInRange(m_range);
+
+    m_haveRequestedFirstNumber = state.haveRequestedFirstNumber;
+    m_lastNumberSelected = static_cast<int>(state.lastNumber);
+    m_generator->setDistribution(m_range.start, m_range.end);
+
+    if(m_haveRequestedFirstNumber) {
+        setForNextStep(m_lastNumberSelected);
+    }
+}
+
 // Private methods
 void Walk::setForNextStep(int lastSelectedNumber)
 {
@@ -96,6 +96,10 @@ class Walk : public NumberProtocol {
 
     NumberProtocolConfig getParams() override;
 
+    NumberProtocolState saveState() override;
+
+    void restoreState(NumberProtocolState state) override;
+
   private:
     std::unique_ptr<IUniformGenerator> m_generator;
     Range m_range;
@@ -20,6 +20,9 @@ class CollectionsProducer {
     std::vector<T> getCollection(int size);
     NumberProtocolParams getParams();
     void setParams(NumberProtocolParams newParams);
+    NumberProtocolState saveState();
+    void restoreState(NumberProtocolState state);
+    void discard(std::uint64_t count);
     void setProtocol(std::unique_ptr<NumberProtocol> protocol);
     void setSource(std::vector<T> newSource);
     std::vector<T> getSource();
@@ -60,10 +63,16 @@ const T &CollectionsProducer<T>::getItem()
 template<typename T>
 std::vector<T> CollectionsProducer<T>::getCollection(int size)
 {
-    std::vector<T> collection(size);
+    std::vector<int> indices(size);
+    m_protocol->getIntegerNumbers(indices.data(), indices.size());
 
-    for(auto &&it : collection) {
-        it = getItem();
+    std::vector<T> collection;
+    collection.reserve(indices.size());
+
+    // NB: using .at() because it will throw an out_of_range exception if the
+    // number is out of bounds
+    for(auto &&index : indices) {
+        collection.push_back(m_source.at(index));
     }
 
     return collection;
@@ -89,6 +98,24 @@ void CollectionsProducer<T>::setParams(NumberProtocolParams newParams)
         NumberProtocolConfig(Range(0, m_source.size() - 1), newParams));
 }
 
+template<typename T>
+NumberProtocolState CollectionsProducer<T>::saveState()
+{
+    return m_protocol->saveState();
+}
+
+template<typename T>
+void CollectionsProducer<T>::restoreState(NumberProtocolState state)
+{
+    m_protocol->restoreState(state);
+}
+
+template<typename T>
+void CollectionsProducer<T>::discard(std::uint64_t count)
+{
+    m_protocol->discard(count);
+}
+
 template<typename T>
 void CollectionsProducer<T>::setProtocol(
     std::unique_ptr<NumberProtocol> protocol)
@@ -32,13 +32,36 @@ std::vector<int> DurationsProducer::getCollection(int size)
 {
     std::vector<int> collection(size);
 
+    // NB: the draws for a deviating duration depend on the index selected, so
+    // the indices cannot be selected ahead of the durations
+    if(m_durationProtocol->hasRandomDurations()) {
+        for(auto &&i : collection) {
+            i = getDuration();
+        }
+        return collection;
+    }
+
+    m_numberProtocol->getIntegerNumbers(collection.data(), collection.size());
     for(auto &&i : collection) {
-        i = getDuration();
+        i = m_durationProtocol->getDuration(i);
     }
 
     return collection;
 }
 
+void DurationsProducer::discard(std::uint64_t count)
+{
+    if(!m_durationProtocol->hasRandomDurations()) {
+        m_numberProtocol->discard(count);
+        return;
+    }
+
+    // NB: the draws for a deviating duration depend on the index selected
+    for(std::uint64_t i = 0; i < count; i++) {
+        getDuration();
+    }
+}
+
 std::vector<int> DurationsProducer::getSelectableDurations()
 {
     return m_durationProtocol->getSelectableDurations();
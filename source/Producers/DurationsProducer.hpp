@@ -19,6 +19,16 @@ class DurationsProducer {
 
     std::vector<int> getCollection(int size);
 
+    /*!
+     * @brief Skips the next count durations, leaving the producer as if
+     * getDuration() had been called count times
+     *
+     * Only the number protocol is skipped (see NumberProtocol::discard),
+     * unless the duration protocol has random durations, in which case each
+     * duration is drawn.
+     */
+    void discard(std::uint64_t count);
+
     std::vector<int> getSelectableDurations();
 
     NumberProtocolParams getParams();
@@ -25,11 +25,7 @@ double NumbersProducer::getDecimalNumber()
 std::vector<int> NumbersProducer::getIntegerCollection(int size)
 {
     std::vector<int> collection(size);
-
-    for(auto &&it : collection) {
-        it = getIntegerNumber();
-    }
-
+    m_protocol->getIntegerNumbers(collection.data(), collection.size());
     return collection;
 }
 
@@ -61,6 +57,21 @@ void NumbersProducer::setParams(NumberProtocolConfig newParams)
     m_protocol->setParams(newParams);
 }
 
+NumberProtocolState NumbersProducer::saveState()
+{
+    return m_protocol->saveState();
+}
+
+void NumbersProducer::restoreState(NumberProtocolState state)
+{
+    m_protocol->restoreState(state);
+}
+
+void NumbersProducer::discard(std::uint64_t count)
+{
+    m_protocol->discard(count);
+}
+
 void NumbersProducer::setProtocol(std::unique_ptr<NumberProtocol> protocol)
 {
     m_protocol = std::move(protocol);
@@ -48,6 +48,17 @@ class NumbersProducer {
 
     void setParams(NumberProtocolConfig newParams);
 
+    /*! @brief Returns the internal state of the protocol (see
+     * NumberProtocol::saveState) */
+    NumberProtocolState saveState();
+
+    /*! @brief Returns the protocol to a state returned by saveState (see
+     * NumberProtocol::restoreState) */
+    void restoreState(NumberProtocolState state);
+
+    /*! @brief Skips the next count numbers (see NumberProtocol::discard) */
+    void discard(std::uint64_t count);
+
     void setProtocol(std::unique_ptr<NumberProtocol> protocol);
 
   private:
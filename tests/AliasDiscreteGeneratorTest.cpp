@@ -0,0 +1,243 @@
+#include "AliasDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("AliasDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    AliasDiscreteGenerator instance(std::vector<double> {1.0, 0.0, 3.0, 4.0},
+                                    42);
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(4, 0);
+        for(int i = 0; i < 8000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2800);
+        REQUIRE(counts[2] < 3200);
+        REQUIRE(counts[3] > 3800);
+        REQUIRE(counts[3] < 4200);
+    }
+
+    WHEN("A large distribution with uneven weights is set")
+    {
+        std::vector<double> distribution(1000);
+        for(size_t i = 0; i < distribution.size(); i++) {
+            distribution[i] = i % 10 == 0 ? 10.0 : i % 3;
+        }
+        instance.setDistributionVector(distribution);
+
+        THEN("Each index is returned in proportion to its weight")
+        {
+            std::vector<int> counts(distribution.size(), 0);
+            for(int i = 0; i < 200000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            double total = 0.0;
+            for(auto &&weight : distribution) {
+                total += weight;
+            }
+
+            for(size_t i = 0; i < distribution.size(); i++) {
+                auto expected = 200000 * distribution[i] / total;
+                REQUIRE(counts[i] == Approx(expected).margin(
+                                         5 * std::sqrt(expected) + 1));
+            }
+        }
+    }
+
+    WHEN("The distribution vector is updated")
+    {
+        instance.updateDistributionVector(0, 0.0);
+        instance.updateDistributionVector(2, 0.0);
+
+        THEN("It is reflected in the numbers returned")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {0.0, 0.0, 0.0, 4.0});
+            for(int i = 0; i < 100; i++) {
+                REQUIRE(instance.getNumber() == 3);
+            }
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.setDistributionVector(4, 0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(4, 0);
+            for(int i = 0; i < 400; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        AliasDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("AliasDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances constructed with the same seed and distribution")
+    {
+        AliasDiscreteGenerator first(std::vector<double> {1.0, 2.0, 3.0}, 42);
+        AliasDiscreteGenerator second(std::vector<double> {1.0, 2.0, 3.0}, 42);
+
+        THEN("They produce identical sequences")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == second.getNumber());
+            }
+        }
+    }
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        AliasDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                AliasDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("AliasDiscreteGenerator: batches of numbers")
+{
+    using namespace aleatoric;
+
+    std::vector<double> distribution {1.0, 0.0, 3.0, 4.0};
+    AliasDiscreteGenerator instance(distribution, 42);
+    AliasDiscreteGenerator reference(distribution, 42);
+
+    // NB: larger than the block the unit numbers are generated in
+    std::vector<int> batch(1000);
+    instance.getNumbers(batch.data(), batch.size());
+
+    THEN("The batch matches requesting the numbers one at a time")
+    {
+        for(auto &&number : batch) {
+            REQUIRE(number == reference.getNumber());
+        }
+        REQUIRE(instance.getNumber() == reference.getNumber());
+    }
+}
+
+SCENARIO("AliasDiscreteGenerator: batched updates")
+{
+    using namespace aleatoric;
+
+    std::vector<double> distribution {1.0, 2.0, 3.0, 4.0};
+    AliasDiscreteGenerator instance(distribution, 42);
+    AliasDiscreteGenerator reference(distribution, 42);
+
+    instance.beginDistributionUpdate();
+    instance.updateDistributionVector(0.0);
+    instance.updateDistributionVector(1, 1.0);
+    instance.updateDistributionVector(3, 1.0);
+    instance.commitDistributionUpdate();
+
+    reference.updateDistributionVector(0.0);
+    reference.updateDistributionVector(1, 1.0);
+    reference.updateDistributionVector(3, 1.0);
+
+    THEN("The distribution is as if each update had been made in turn")
+    {
+        REQUIRE(instance.getDistributionVector() ==
+                std::vector<double> {0.0, 1.0, 0.0, 1.0});
+
+        for(int i = 0; i < 1000; i++) {
+            REQUIRE(instance.getNumber() == reference.getNumber());
+        }
+    }
+}
+
+SCENARIO("AliasDiscreteGenerator: table cache")
+{
+    using namespace aleatoric;
+
+    std::vector<double> first {1.0, 2.0, 3.0, 4.0};
+    std::vector<double> second {4.0, 0.0, 1.0, 1.0};
+    AliasDiscreteGenerator instance(first, 42);
+    AliasDiscreteGenerator reference(first, 42);
+    instance.setTableCacheCapacity(2);
+
+    WHEN("The distribution returns to vectors held in the cache")
+    {
+        THEN("The numbers match those from tables built afresh")
+        {
+            for(int round = 0; round < 4; round++) {
+                auto &distribution = round % 2 == 0 ? second : first;
+                instance.setDistributionVector(distribution);
+                reference.setDistributionVector(distribution);
+
+                for(int i = 0; i < 250; i++) {
+                    REQUIRE(instance.getNumber() == reference.getNumber());
+                }
+            }
+        }
+    }
+
+    WHEN("A single weight is updated after the table is cached")
+    {
+        instance.setDistributionVector(second);
+        instance.updateDistributionVector(1, 4.0);
+        reference.setDistributionVector(second);
+        reference.updateDistributionVector(1, 4.0);
+
+        THEN("The updated distribution is sampled")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
@@ -702,3 +702,25 @@ SCENARIO("CollectionsProducer: Change source collection")
         }
     }
 }
+
+SCENARIO("CollectionsProducer: Discarding items")
+{
+    using namespace aleatoric;
+
+    std::vector<char> source {'a', 'b', 'c', 'd', 'e'};
+
+    CollectionsProducer<char> instance(
+        source,
+        NumberProtocol::create(NumberProtocol::Type::serial, 42));
+    CollectionsProducer<char> reference(
+        source,
+        NumberProtocol::create(NumberProtocol::Type::serial, 42));
+
+    instance.discard(1002);
+    reference.getCollection(1002);
+
+    THEN("Discarding matches requesting the same number of items")
+    {
+        REQUIRE(instance.getCollection(100) == reference.getCollection(100));
+    }
+}
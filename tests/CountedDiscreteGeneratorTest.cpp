@@ -0,0 +1,136 @@
+#include "CountedDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("CountedDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    CountedDiscreteGenerator instance(
+        std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+        42);
+
+    THEN("The support holds the counts above zero")
+    {
+        REQUIRE(instance.getSupportSize() == 3);
+    }
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(5, 0);
+        for(int i = 0; i < 8000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2800);
+        REQUIRE(counts[2] < 3200);
+        REQUIRE(counts[3] > 3800);
+        REQUIRE(counts[3] < 4200);
+        REQUIRE(counts[4] == 0);
+    }
+
+    WHEN("The counts are drawn down by one for each number selected")
+    {
+        instance.setDistributionVector(
+            std::vector<double> {40000.0, 3.0, 250.0, 0.0});
+
+        THEN("Each index is returned as many times as its count")
+        {
+            std::vector<int> counts(4, 0);
+            for(int i = 0; i < 40253; i++) {
+                auto number = instance.getNumber();
+                counts[number]++;
+                instance.updateDistributionVector(
+                    number,
+                    instance.viewDistributionVector()[number] - 1.0);
+            }
+
+            REQUIRE(counts == std::vector<int> {40000, 3, 250, 0});
+            REQUIRE(instance.getSupportSize() == 0);
+        }
+    }
+
+    WHEN("Every count is zero")
+    {
+        instance.updateDistributionVector(0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 500; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("A weight is not a whole number of zero or more")
+    {
+        THEN("Setting it throws")
+        {
+            REQUIRE_THROWS_AS(instance.updateDistributionVector(0, 0.5),
+                              std::invalid_argument);
+            REQUIRE_THROWS_AS(instance.updateDistributionVector(0, -1.0),
+                              std::invalid_argument);
+            REQUIRE_THROWS_AS(
+                instance.setDistributionVector(std::vector<double> {1.0, 0.5}),
+                std::invalid_argument);
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        CountedDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("CountedDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        CountedDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                CountedDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
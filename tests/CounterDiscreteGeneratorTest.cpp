@@ -0,0 +1,87 @@
+#include "CounterDiscreteGenerator.hpp"
+
+#include "CounterEngine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("CounterDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    auto engine = std::make_shared<CounterEngine>(42);
+    CounterDiscreteGenerator instance(std::vector<double> {1.0, 0.0, 3.0},
+                                      engine);
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(3, 0);
+        for(int i = 0; i < 4000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2850);
+        REQUIRE(counts[2] < 3150);
+    }
+
+    WHEN("The engine position is set")
+    {
+        std::vector<int> sequence(100);
+        for(auto &&i : sequence) {
+            i = instance.getNumber();
+        }
+
+        engine->setPosition(51);
+
+        THEN("The next number is the one at that position of the sequence")
+        {
+            REQUIRE(instance.getNumber() == sequence[51]);
+            REQUIRE(instance.getNumber() == sequence[52]);
+        }
+    }
+
+    WHEN("The distribution vector is updated")
+    {
+        instance.updateDistributionVector(2, 0.0);
+
+        THEN("It is reflected in the numbers returned")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 0.0, 0.0});
+            for(int i = 0; i < 100; i++) {
+                REQUIRE(instance.getNumber() == 0);
+            }
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.setDistributionVector(4, 0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(4, 0);
+            for(int i = 0; i < 400; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("A null engine is supplied")
+    {
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(CounterDiscreteGenerator(nullptr),
+                              std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "CounterEngine.hpp"
+
+#include <catch2/catch.hpp>
+#include <set>
+#include <vector>
+
+SCENARIO("CounterEngine")
+{
+    using namespace aleatoric;
+
+    CounterEngine engine(42);
+
+    THEN("Values are a function of the key and index only")
+    {
+        CounterEngine sameKey(42);
+        sameKey.setPosition(1000);
+
+        for(std::uint64_t i = 0; i < 100; i++) {
+            REQUIRE(engine.getValue(i) == sameKey.getValue(i));
+            REQUIRE(engine.getValue(i, 1) == sameKey.getValue(i, 1));
+        }
+    }
+
+    THEN("Values differ between keys, indices and sub-indices")
+    {
+        CounterEngine otherKey(43);
+        std::set<std::uint64_t> values;
+
+        for(std::uint64_t i = 0; i < 1000; i++) {
+            values.insert(engine.getValue(i));
+            values.insert(engine.getValue(i, 1));
+            values.insert(otherKey.getValue(i));
+        }
+
+        REQUIRE(values.size() == 3000);
+    }
+
+    THEN("Bounded numbers are below the bound and evenly spread")
+    {
+        std::vector<int> counts(6, 0);
+        for(std::uint64_t i = 0; i < 6000; i++) {
+            auto number = engine.getBoundedNumber(i, 6);
+            REQUIRE(number < 6);
+            counts[number]++;
+        }
+
+        for(auto &&count : counts) {
+            REQUIRE(count > 850);
+            REQUIRE(count < 1150);
+        }
+    }
+
+    THEN("Unit numbers are in [0, 1)")
+    {
+        for(std::uint64_t i = 0; i < 1000; i++) {
+            auto number = engine.getUnitNumber(i);
+            REQUIRE(number >= 0.0);
+            REQUIRE(number < 1.0);
+        }
+    }
+
+    THEN("Taking an index moves the position on by one")
+    {
+        engine.setPosition(10);
+        REQUIRE(engine.takeIndex() == 10);
+        REQUIRE(engine.takeIndex() == 11);
+        REQUIRE(engine.getPosition() == 12);
+    }
+}
@@ -0,0 +1,69 @@
+#include "CounterUniformGenerator.hpp"
+
+#include "CounterEngine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("CounterUniformGenerator")
+{
+    using namespace aleatoric;
+
+    auto engine = std::make_shared<CounterEngine>(42);
+    CounterUniformGenerator instance(1, 10, engine);
+
+    THEN("Numbers are within the range")
+    {
+        for(int i = 0; i < 1000; i++) {
+            auto number = instance.getNumber();
+            REQUIRE(number >= 1);
+            REQUIRE(number <= 10);
+        }
+    }
+
+    WHEN("The engine position is set")
+    {
+        std::vector<int> sequence(100);
+        for(auto &&i : sequence) {
+            i = instance.getNumber();
+        }
+
+        engine->setPosition(37);
+
+        THEN("The next number is the one at that position of the sequence")
+        {
+            REQUIRE(instance.getNumber() == sequence[37]);
+            REQUIRE(instance.getNumber() == sequence[38]);
+        }
+    }
+
+    WHEN("Two generators share a key but not an engine")
+    {
+        auto windowEngine = std::make_shared<CounterEngine>(42);
+        CounterUniformGenerator window(1, 10, windowEngine);
+
+        std::vector<int> sequence(100);
+        for(auto &&i : sequence) {
+            i = instance.getNumber();
+        }
+
+        THEN("Either can generate any window of the sequence")
+        {
+            windowEngine->setPosition(60);
+            for(int i = 60; i < 100; i++) {
+                REQUIRE(window.getNumber() == sequence[i]);
+            }
+        }
+    }
+
+    WHEN("A null engine is supplied")
+    {
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(CounterUniformGenerator(nullptr),
+                              std::invalid_argument);
+        }
+    }
+}
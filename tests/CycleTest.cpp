@@ -1,5 +1,6 @@
 #include "Cycle.hpp"
 
+#include "NumberProtocolParameters.hpp"
 #include "Range.hpp"
 
 #include <catch2/catch.hpp>
@@ -739,3 +740,127 @@ SCENARIO("Numbers::Cycle: Set params: with last returned number")
         }
     }
 }
+
+SCENARIO("Numbers::Cycle: state")
+{
+    using namespace aleatoric;
+
+    Cycle instance(Range(1, 4), true, false);
+
+    // 1, 2, 3, 4, 3: now heading back down
+    for(int i = 0; i < 5; i++) {
+        instance.getIntegerNumber();
+    }
+
+    auto state = instance.saveState();
+
+    WHEN("The state is restored to a new instance with the same params")
+    {
+        Cycle restored(Range(1, 4), true, false);
+        restored.restoreState(state);
+
+        THEN("It continues the cycle in the same direction")
+        {
+            std::vector<int> set(6);
+            for(auto &&i : set) {
+                i = restored.getIntegerNumber();
+            }
+
+            REQUIRE(set == std::vector<int> {2, 1, 2, 3, 4, 3});
+        }
+    }
+
+    WHEN("A state that does not match the protocol is restored")
+    {
+        state.counters.pop_back();
+
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(instance.restoreState(state),
+                              std::invalid_argument);
+        }
+    }
+
+    WHEN("A state whose next position is outside the range is restored")
+    {
+        state.counters[0] = 5;
+
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(instance.restoreState(state),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Numbers::Cycle: discard")
+{
+    using namespace aleatoric;
+
+    std::vector<std::pair<bool, bool>> directions {{false, false},
+                                                   {false, true},
+                                                   {true, false},
+                                                   {true, true}};
+
+    THEN("Discarding matches requesting the same number of numbers, from "
+         "any point in the cycle")
+    {
+        for(auto &&direction : directions) {
+            for(int start = 0; start < 8; start++) {
+                for(int count = 0; count < 20; count++) {
+                    Cycle instance(Range(1, 4),
+                                   direction.first,
+                                   direction.second);
+                    Cycle reference(Range(1, 4),
+                                    direction.first,
+                                    direction.second);
+                    for(int i = 0; i < start; i++) {
+                        instance.getIntegerNumber();
+                        reference.getIntegerNumber();
+                    }
+
+                    instance.discard(count);
+                    for(int i = 0; i < count; i++) {
+                        reference.getIntegerNumber();
+                    }
+
+                    auto state = instance.saveState();
+                    auto referenceState = reference.saveState();
+                    REQUIRE(state.counters == referenceState.counters);
+                    REQUIRE(state.lastNumber == referenceState.lastNumber);
+                    for(int i = 0; i < 10; i++) {
+                        REQUIRE(instance.getIntegerNumber() ==
+                                reference.getIntegerNumber());
+                    }
+                }
+            }
+        }
+    }
+
+    WHEN("A very large number of numbers is discarded")
+    {
+        Cycle instance(Range(1, 4), true, false);
+        instance.discard(6000000005);
+
+        THEN("The cycle continues from the closed form position")
+        {
+            // 6000000005 % 6 == 5: 1, 2, 3, 4, 3 have been returned
+            REQUIRE(instance.getIntegerNumber() == 2);
+            REQUIRE(instance.getIntegerNumber() == 1);
+        }
+    }
+
+    WHEN("The range is changed after discarding")
+    {
+        Cycle instance(Range(1, 4));
+        instance.discard(6);
+        instance.setParams(NumberProtocolConfig(
+            Range(1, 10),
+            NumberProtocolParams(CycleParams(false, false))));
+
+        THEN("The cycle continues from the last position")
+        {
+            REQUIRE(instance.getIntegerNumber() == 3);
+        }
+    }
+}
@@ -1,6 +1,9 @@
 #include "DiscreteGenerator.hpp"
 
+#include "Engine.hpp"
+
 #include <catch2/catch.hpp>
+#include <stdexcept>
 
 SCENARIO("DiscreteGenerator")
 {
@@ -173,3 +176,241 @@ SCENARIO("DiscreteGenerator")
         }
     }
 }
+
+SCENARIO("DiscreteGenerator: seeded construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances constructed with the same seed and distribution")
+    {
+        DiscreteGenerator first(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 42);
+        DiscreteGenerator second(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 42);
+
+        THEN("They produce identical sequences")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == second.getNumber());
+            }
+        }
+    }
+
+    GIVEN("Instances constructed with only a seed and with a size and value")
+    {
+        DiscreteGenerator seedOnly(42);
+        DiscreteGenerator sized(3, 1.0, 42);
+
+        THEN("The distribution vectors are set as for the unseeded versions")
+        {
+            REQUIRE(seedOnly.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+            REQUIRE(sized.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0, 1.0});
+        }
+    }
+}
+
+SCENARIO("DiscreteGenerator: shared engine")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances sharing an engine")
+    {
+        auto engine = std::make_shared<Engine>(42);
+        DiscreteGenerator first(std::vector<double> {1.0, 2.0, 3.0}, engine);
+        DiscreteGenerator second(std::vector<double> {1.0, 2.0, 3.0}, engine);
+
+        THEN("Their interleaved draws match the sequence of a single instance "
+             "with its own engine seeded the same")
+        {
+            DiscreteGenerator reference(std::vector<double> {1.0, 2.0, 3.0},
+                                        42);
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == reference.getNumber());
+                REQUIRE(second.getNumber() == reference.getNumber());
+            }
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(DiscreteGenerator(std::shared_ptr<Engine>()),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("DiscreteGenerator: discarding numbers")
+{
+    using namespace aleatoric;
+
+    DiscreteGenerator instance(std::vector<double> {1.0, 0.0, 3.0, 4.0}, 42);
+    DiscreteGenerator reference(std::vector<double> {1.0, 0.0, 3.0, 4.0}, 42);
+
+    instance.discard(1000);
+    for(int i = 0; i < 1000; i++) {
+        reference.getNumber();
+    }
+
+    THEN("Discarding matches requesting the same number of numbers")
+    {
+        for(int i = 0; i < 1000; i++) {
+            REQUIRE(instance.getNumber() == reference.getNumber());
+        }
+    }
+}
+
+SCENARIO("DiscreteGenerator: discarding numbers from a single weight")
+{
+    using namespace aleatoric;
+
+    auto engine = std::make_shared<Engine>(42);
+    auto referenceEngine = std::make_shared<Engine>(42);
+    DiscreteGenerator instance(std::vector<double> {1.0}, engine);
+    DiscreteGenerator reference(std::vector<double> {1.0}, referenceEngine);
+
+    instance.discard(1000);
+    for(int i = 0; i < 1000; i++) {
+        reference.getNumber();
+    }
+
+    THEN("The engine is left as requesting the numbers leaves it")
+    {
+        REQUIRE(instance.getNumber() == 0);
+        REQUIRE((*engine)() == (*referenceEngine)());
+    }
+}
+
+SCENARIO("DiscreteGenerator: viewing the distribution")
+{
+    using namespace aleatoric;
+
+    DiscreteGenerator instance(std::vector<double> {1.0, 2.0, 3.0});
+    const auto &view = instance.viewDistributionVector();
+
+    THEN("The view holds the distribution")
+    {
+        REQUIRE(view == std::vector<double> {1.0, 2.0, 3.0});
+    }
+
+    WHEN("The distribution is updated")
+    {
+        instance.updateDistributionVector(1, 0.0);
+
+        THEN("The view reflects the update")
+        {
+            REQUIRE(view == std::vector<double> {1.0, 0.0, 3.0});
+        }
+    }
+}
+
+SCENARIO("DiscreteGenerator: batched updates")
+{
+    using namespace aleatoric;
+
+    DiscreteGenerator instance(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 42);
+    DiscreteGenerator reference(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 42);
+
+    instance.beginDistributionUpdate();
+    instance.updateDistributionVector(0.0);
+    instance.updateDistributionVector(1, 1.0);
+    instance.updateDistributionVector(3, 1.0);
+    instance.commitDistributionUpdate();
+
+    reference.updateDistributionVector(0.0);
+    reference.updateDistributionVector(1, 1.0);
+    reference.updateDistributionVector(3, 1.0);
+
+    THEN("The distribution is as if each update had been made in turn")
+    {
+        REQUIRE(instance.getDistributionVector() ==
+                std::vector<double> {0.0, 1.0, 0.0, 1.0});
+
+        for(int i = 0; i < 1000; i++) {
+            REQUIRE(instance.getNumber() == reference.getNumber());
+        }
+    }
+}
+
+SCENARIO("DiscreteGenerator: nested batched updates")
+{
+    using namespace aleatoric;
+
+    DiscreteGenerator instance(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 42);
+    DiscreteGenerator reference(std::vector<double> {1.0, 2.0, 3.0, 4.0}, 42);
+
+    reference.updateDistributionVector(0.0);
+    reference.updateDistributionVector(1, 1.0);
+    reference.updateDistributionVector(3, 1.0);
+
+    WHEN("A batch is begun and committed within another")
+    {
+        instance.beginDistributionUpdate();
+        instance.updateDistributionVector(0.0);
+        instance.beginDistributionUpdate();
+        instance.updateDistributionVector(1, 1.0);
+        instance.commitDistributionUpdate();
+        instance.updateDistributionVector(3, 1.0);
+        instance.commitDistributionUpdate();
+
+        THEN("The outermost commit rebuilds the distribution")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {0.0, 1.0, 0.0, 1.0});
+
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+
+    WHEN("An exception leaves the scope of a DistributionUpdate")
+    {
+        try {
+            DistributionUpdate update(instance);
+            instance.updateDistributionVector(0.0);
+            instance.updateDistributionVector(1, 1.0);
+            throw std::runtime_error("interrupted");
+        } catch(const std::runtime_error &) {
+        }
+
+        instance.updateDistributionVector(3, 1.0);
+
+        THEN("The batch is committed and later updates rebuild immediately")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {0.0, 1.0, 0.0, 1.0});
+
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("DiscreteGenerator: table cache")
+{
+    using namespace aleatoric;
+
+    DiscreteGenerator instance(3, 1.0, 42);
+    DiscreteGenerator reference(3, 1.0, 42);
+    instance.setTableCacheCapacity(3);
+
+    WHEN("The distribution favours each index in turn, as Periodic's does")
+    {
+        THEN("The numbers match those from distributions built afresh")
+        {
+            for(int round = 0; round < 9; round++) {
+                std::vector<double> distribution(3, 0.25);
+                distribution[round % 3] = 0.5;
+                instance.setDistributionVector(distribution);
+                reference.setDistributionVector(distribution);
+
+                for(int i = 0; i < 100; i++) {
+                    REQUIRE(instance.getNumber() == reference.getNumber());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#include "DistributionTableCache.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <vector>
+
+SCENARIO("DistributionTableCache")
+{
+    using namespace aleatoric;
+
+    int builds = 0;
+    auto build = [&builds]() {
+        builds++;
+        return std::make_shared<int>(builds);
+    };
+
+    std::vector<double> first {1.0, 2.0};
+    std::vector<double> second {2.0, 1.0};
+    std::vector<double> third {1.0, 2.0, 0.0};
+
+    GIVEN("A cache with a capacity of two")
+    {
+        DistributionTableCache<int> cache(2);
+
+        WHEN("A vector is looked up for the first time")
+        {
+            auto table = cache.getTable(first, build);
+
+            THEN("Its table is built and held")
+            {
+                REQUIRE(*table == 1);
+                REQUIRE(builds == 1);
+                REQUIRE(cache.size() == 1);
+            }
+
+            AND_WHEN("It is looked up again")
+            {
+                auto again = cache.getTable(first, build);
+
+                THEN("The table held is returned without a build")
+                {
+                    REQUIRE(again == table);
+                    REQUIRE(builds == 1);
+                }
+            }
+        }
+
+        WHEN("More vectors are looked up than it can hold")
+        {
+            cache.getTable(first, build);
+            cache.getTable(second, build);
+            // first becomes the most recently used
+            cache.getTable(first, build);
+            cache.getTable(third, build);
+
+            THEN("The least recently used table is dropped")
+            {
+                REQUIRE(cache.size() == 2);
+                REQUIRE(builds == 3);
+
+                cache.getTable(first, build);
+                REQUIRE(builds == 3);
+
+                cache.getTable(second, build);
+                REQUIRE(builds == 4);
+            }
+        }
+
+        WHEN("The capacity is reduced")
+        {
+            cache.getTable(first, build);
+            cache.getTable(second, build);
+            cache.setCapacity(1);
+
+            THEN("Tables beyond it are dropped")
+            {
+                REQUIRE(cache.size() == 1);
+
+                cache.getTable(second, build);
+                REQUIRE(builds == 2);
+            }
+        }
+    }
+
+    GIVEN("A cache with a capacity of zero")
+    {
+        DistributionTableCache<int> cache;
+
+        THEN("Every lookup builds a table and none are held")
+        {
+            cache.getTable(first, build);
+            cache.getTable(first, build);
+            REQUIRE(builds == 2);
+            REQUIRE(cache.size() == 0);
+        }
+    }
+}
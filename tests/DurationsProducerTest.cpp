@@ -718,3 +718,48 @@ SCENARIO("DurationsProducer: Observing changes to params (registering, "
         }
     }
 }
+
+SCENARIO("DurationsProducer: Discarding durations")
+{
+    using namespace aleatoric;
+
+    GIVEN("A duration protocol without random durations")
+    {
+        auto makeProducer = []() {
+            return std::make_unique<DurationsProducer>(
+                DurationProtocol::createMultiples(100, Range(1, 10)),
+                NumberProtocol::create(NumberProtocol::Type::basic, 42));
+        };
+        auto instance = makeProducer();
+        auto reference = makeProducer();
+
+        instance->discard(1000);
+        reference->getCollection(1000);
+
+        THEN("Discarding matches requesting the same number of durations")
+        {
+            REQUIRE(instance->getCollection(100) ==
+                    reference->getCollection(100));
+        }
+    }
+
+    GIVEN("A duration protocol with random durations")
+    {
+        auto makeProducer = []() {
+            return std::make_unique<DurationsProducer>(
+                DurationProtocol::createMultiples(100, Range(1, 10), 0.1, 7),
+                NumberProtocol::create(NumberProtocol::Type::basic, 42));
+        };
+        auto instance = makeProducer();
+        auto reference = makeProducer();
+
+        instance->discard(1000);
+        reference->getCollection(1000);
+
+        THEN("Discarding matches requesting the same number of durations")
+        {
+            REQUIRE(instance->getCollection(100) ==
+                    reference->getCollection(100));
+        }
+    }
+}
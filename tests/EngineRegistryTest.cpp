@@ -0,0 +1,55 @@
+#include "EngineRegistry.hpp"
+
+#include "Engine.hpp"
+#include "UniformGenerator.hpp"
+
+#include <catch2/catch.hpp>
+#include <thread>
+
+SCENARIO("EngineRegistry")
+{
+    using namespace aleatoric;
+
+    WHEN("The thread engine is requested twice on the same thread")
+    {
+        auto first = EngineRegistry::getThreadEngine();
+        auto second = EngineRegistry::getThreadEngine();
+
+        THEN("The same engine is returned")
+        {
+            REQUIRE(first != nullptr);
+            REQUIRE(first == second);
+        }
+    }
+
+    WHEN("The thread engine is requested on different threads")
+    {
+        auto mainThreadEngine = EngineRegistry::getThreadEngine();
+        std::shared_ptr<Engine> workerThreadEngine;
+
+        std::thread worker([&workerThreadEngine]() {
+            workerThreadEngine = EngineRegistry::getThreadEngine();
+        });
+        worker.join();
+
+        THEN("Each thread has its own engine")
+        {
+            REQUIRE(workerThreadEngine != nullptr);
+            REQUIRE(workerThreadEngine != mainThreadEngine);
+        }
+    }
+
+    WHEN("Generators are default constructed")
+    {
+        auto engine = EngineRegistry::getThreadEngine();
+        auto useCount = engine.use_count();
+
+        UniformGenerator first;
+        UniformGenerator second(0, 10);
+
+        THEN("They draw from the thread engine")
+        {
+            REQUIRE(engine.use_count() == useCount + 2);
+        }
+    }
+}
@@ -0,0 +1,438 @@
+#include "Engine.hpp"
+
+#include "HashedSeedSource.hpp"
+#include "IEntropySource.hpp"
+
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+std::vector<aleatoric::Engine::result_type> draw(aleatoric::Engine &engine,
+                                                 int count)
+{
+    std::vector<aleatoric::Engine::result_type> numbers(count);
+    for(auto &&i : numbers) {
+        i = engine();
+    }
+    return numbers;
+}
+
+class CountingEntropySource : public aleatoric::IEntropySource {
+  public:
+    std::uint64_t getSeed() override
+    {
+        return ++count;
+    }
+
+    int count = 0;
+};
+} // namespace
+
+SCENARIO("Engine: seeding")
+{
+    using namespace aleatoric;
+
+    WHEN("Two engines are constructed with the same seed")
+    {
+        Engine first(42);
+        Engine second(42);
+
+        THEN("They produce identical sequences")
+        {
+            REQUIRE(draw(first, 1000) == draw(second, 1000));
+        }
+    }
+
+    WHEN("Two engines are constructed with different seeds")
+    {
+        Engine first(42);
+        Engine second(43);
+
+        THEN("They produce different sequences")
+        {
+            REQUIRE(draw(first, 1000) != draw(second, 1000));
+        }
+    }
+}
+
+SCENARIO("Engine: lazy seeding")
+{
+    using namespace aleatoric;
+
+    WHEN("An engine is constructed with a seed")
+    {
+        Engine engine(42);
+
+        THEN("It is seeded immediately")
+        {
+            REQUIRE(engine.isSeeded());
+        }
+    }
+
+    WHEN("An engine is constructed without a seed")
+    {
+        Engine engine;
+        Engine bufferedEngine;
+        bufferedEngine.setBuffered(true);
+
+        THEN("It is not seeded until first used")
+        {
+            REQUIRE_FALSE(engine.isSeeded());
+            REQUIRE_FALSE(bufferedEngine.isSeeded());
+            engine();
+            bufferedEngine();
+            REQUIRE(engine.isSeeded());
+            REQUIRE(bufferedEngine.isSeeded());
+        }
+
+        THEN("Accessing the pcg engine seeds it")
+        {
+            engine.getEngine();
+            REQUIRE(engine.isSeeded());
+        }
+
+        THEN("Each engine is seeded independently")
+        {
+            Engine other;
+            REQUIRE(draw(engine, 1000) != draw(other, 1000));
+        }
+    }
+}
+
+SCENARIO("Engine: entropy sources")
+{
+    using namespace aleatoric;
+
+    WHEN("An engine is constructed with an entropy source")
+    {
+        auto source = std::make_shared<CountingEntropySource>();
+        Engine engine(source);
+
+        THEN("The source is not read until the engine is first used")
+        {
+            REQUIRE(source->count == 0);
+            engine();
+            REQUIRE(source->count > 0);
+
+            auto count = source->count;
+            draw(engine, 1000);
+            REQUIRE(source->count == count);
+        }
+    }
+
+    WHEN("Engines are seeded from sources with the same master seed")
+    {
+        Engine first(std::make_shared<HashedSeedSource>(42));
+        Engine second(std::make_shared<HashedSeedSource>(42));
+
+        THEN("They produce identical sequences")
+        {
+            REQUIRE(draw(first, 1000) == draw(second, 1000));
+        }
+    }
+
+    WHEN("The default entropy source is replaced")
+    {
+        auto originalSource = Engine::getDefaultEntropySource();
+        Engine::setDefaultEntropySource(std::make_shared<HashedSeedSource>(42));
+        Engine first;
+        Engine::setDefaultEntropySource(std::make_shared<HashedSeedSource>(42));
+        Engine second;
+        Engine::setDefaultEntropySource(originalSource);
+
+        THEN("Engines constructed without a seed use it")
+        {
+            REQUIRE(draw(first, 1000) == draw(second, 1000));
+        }
+    }
+
+    WHEN("A null entropy source is supplied")
+    {
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(Engine(nullptr), std::invalid_argument);
+            REQUIRE_THROWS_AS(Engine::setDefaultEntropySource(nullptr),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Engine: streams")
+{
+    using namespace aleatoric;
+
+    WHEN("Two engines share a seed and stream id")
+    {
+        Engine first(42, 7);
+        Engine second(42, 7);
+
+        THEN("They produce identical sequences")
+        {
+            REQUIRE(draw(first, 1000) == draw(second, 1000));
+        }
+    }
+
+    WHEN("Two engines share a seed but not a stream id")
+    {
+        Engine first(42, 7);
+        Engine second(42, 8);
+
+        THEN("They produce different sequences")
+        {
+            REQUIRE(draw(first, 1000) != draw(second, 1000));
+        }
+    }
+
+    WHEN("A set of streams is created")
+    {
+        auto streams = Engine::createStreams(42, 4);
+
+        THEN("Each engine matches the engine for its stream id")
+        {
+            REQUIRE(streams.size() == 4);
+            for(size_t i = 0; i < streams.size(); i++) {
+                Engine reference(42, i);
+                REQUIRE(draw(*streams[i], 100) == draw(reference, 100));
+            }
+        }
+    }
+
+    WHEN("A negative number of streams is requested")
+    {
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(Engine::createStreams(42, -1),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Engine: advance")
+{
+    using namespace aleatoric;
+
+    Engine advanced(42);
+    Engine stepped(42);
+
+    advanced.advance(12345);
+    draw(stepped, 12345);
+
+    THEN("Advancing matches drawing the same number of outputs")
+    {
+        REQUIRE(draw(advanced, 100) == draw(stepped, 100));
+    }
+}
+
+SCENARIO("Engine: bounded numbers")
+{
+    using namespace aleatoric;
+
+    Engine engine(42);
+
+    THEN("Numbers are below the bound and evenly spread")
+    {
+        std::vector<int> counts(6, 0);
+        for(int i = 0; i < 6000; i++) {
+            auto number = engine.getBoundedNumber(6);
+            REQUIRE(number < 6);
+            counts[number]++;
+        }
+
+        for(auto &&count : counts) {
+            REQUIRE(count > 850);
+            REQUIRE(count < 1150);
+        }
+    }
+
+    THEN("A bound of 1 always returns 0")
+    {
+        for(int i = 0; i < 100; i++) {
+            REQUIRE(engine.getBoundedNumber(1) == 0);
+        }
+    }
+
+    THEN("A bound of 0 returns the full output")
+    {
+        Engine reference(42);
+        for(int i = 0; i < 100; i++) {
+            REQUIRE(engine.getBoundedNumber(0) ==
+                    static_cast<std::uint32_t>(reference()));
+        }
+    }
+}
+
+SCENARIO("Engine: unit numbers")
+{
+    using namespace aleatoric;
+
+    Engine engine(42);
+
+    THEN("Numbers are in [0, 1) and average one half")
+    {
+        double sum = 0.0;
+        for(int i = 0; i < 10000; i++) {
+            auto number = engine.getUnitNumber();
+            REQUIRE(number >= 0.0);
+            REQUIRE(number < 1.0);
+            sum += number;
+        }
+
+        REQUIRE(sum / 10000 == Approx(0.5).margin(0.02));
+    }
+
+    THEN("Bulk generation matches individual numbers")
+    {
+        Engine reference(42);
+        std::vector<double> bulkSet(1001);
+        engine.generateUnitNumbers(bulkSet.data(), bulkSet.size());
+
+        for(auto &&number : bulkSet) {
+            REQUIRE(number == reference.getUnitNumber());
+        }
+        REQUIRE(draw(engine, 10) == draw(reference, 10));
+    }
+}
+
+SCENARIO("Engine: state")
+{
+    using namespace aleatoric;
+
+    Engine engine(42);
+    draw(engine, 100);
+    auto state = engine.saveState();
+    auto expected = draw(engine, 1000);
+
+    WHEN("The state is restored to the same engine")
+    {
+        engine.restoreState(state);
+
+        THEN("It repeats the sequence from the saved point")
+        {
+            REQUIRE(draw(engine, 1000) == expected);
+        }
+    }
+
+    WHEN("The state is restored to a buffered engine part way through a block")
+    {
+        Engine other(7);
+        other.setBuffered(true);
+        draw(other, 10);
+        other.restoreState(state);
+
+        THEN("It continues from the saved point")
+        {
+            REQUIRE(draw(other, 1000) == expected);
+        }
+    }
+
+    WHEN("The state is saved from a buffered engine")
+    {
+        Engine buffered(42);
+        buffered.setBuffered(true);
+        draw(buffered, 100);
+        auto bufferedState = buffered.saveState();
+
+        THEN("It matches the state of the unbuffered engine")
+        {
+            REQUIRE(bufferedState == state);
+        }
+    }
+
+    WHEN("An invalid state is restored")
+    {
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(engine.restoreState("not a state"),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Engine: buffering")
+{
+    using namespace aleatoric;
+
+    Engine buffered(42);
+    Engine unbuffered(42);
+    buffered.setBuffered(true);
+
+    THEN("Buffering is reported")
+    {
+        REQUIRE(buffered.isBuffered());
+        REQUIRE_FALSE(unbuffered.isBuffered());
+    }
+
+    THEN("Buffered and unbuffered engines produce identical sequences")
+    {
+        REQUIRE(draw(buffered, 1000) == draw(unbuffered, 1000));
+    }
+
+    WHEN("Raw outputs are mixed with direct use of the pcg engine")
+    {
+        std::vector<aleatoric::Engine::result_type> bufferedSet(10);
+        std::vector<aleatoric::Engine::result_type> unbufferedSet(10);
+
+        for(size_t i = 0; i < bufferedSet.size(); i++) {
+            draw(buffered, 100);
+            draw(unbuffered, 100);
+            bufferedSet[i] = buffered.getEngine()();
+            unbufferedSet[i] = unbuffered.getEngine()();
+        }
+
+        THEN("The sequences remain identical")
+        {
+            REQUIRE(bufferedSet == unbufferedSet);
+            REQUIRE(draw(buffered, 1000) == draw(unbuffered, 1000));
+        }
+    }
+
+    WHEN("The engines are advanced part way through a block")
+    {
+        draw(buffered, 10);
+        draw(unbuffered, 10);
+        buffered.advance(500);
+        unbuffered.advance(500);
+
+        THEN("The sequences remain identical")
+        {
+            REQUIRE(draw(buffered, 1000) == draw(unbuffered, 1000));
+        }
+    }
+
+    WHEN("Buffering is switched off part way through a block")
+    {
+        draw(buffered, 10);
+        draw(unbuffered, 10);
+        buffered.setBuffered(false);
+
+        THEN("The sequences remain identical")
+        {
+            REQUIRE_FALSE(buffered.isBuffered());
+            REQUIRE(draw(buffered, 1000) == draw(unbuffered, 1000));
+        }
+    }
+}
+
+SCENARIO("Engine: bulk generation")
+{
+    using namespace aleatoric;
+
+    Engine bulk(42);
+    Engine single(42);
+
+    WHEN("Outputs are generated in bulk")
+    {
+        draw(bulk, 3);
+        draw(single, 3);
+
+        std::vector<aleatoric::Engine::result_type> bulkSet(1001);
+        bulk.generate(bulkSet.data(), bulkSet.size());
+
+        THEN("They match the same number of single draws")
+        {
+            REQUIRE(bulkSet == draw(single, 1001));
+            REQUIRE(draw(bulk, 100) == draw(single, 100));
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include "HashedSeedSource.hpp"
+#include "OsEntropySource.hpp"
+
+#include <catch2/catch.hpp>
+#include <set>
+#include <vector>
+
+SCENARIO("HashedSeedSource")
+{
+    using namespace aleatoric;
+
+    WHEN("Two sources share a master seed")
+    {
+        HashedSeedSource first(42);
+        HashedSeedSource second(42);
+
+        THEN("They return the same sequence of seeds")
+        {
+            for(int i = 0; i < 100; i++) {
+                REQUIRE(first.getSeed() == second.getSeed());
+            }
+        }
+    }
+
+    WHEN("Two sources have adjacent master seeds")
+    {
+        HashedSeedSource first(42);
+        HashedSeedSource second(43);
+
+        THEN("Their seeds differ")
+        {
+            for(int i = 0; i < 100; i++) {
+                REQUIRE(first.getSeed() != second.getSeed());
+            }
+        }
+    }
+
+    WHEN("Many seeds are requested")
+    {
+        HashedSeedSource source(0);
+        std::set<std::uint64_t> seeds;
+        for(int i = 0; i < 10000; i++) {
+            seeds.insert(source.getSeed());
+        }
+
+        THEN("They are all different")
+        {
+            REQUIRE(seeds.size() == 10000);
+        }
+    }
+}
+
+SCENARIO("OsEntropySource")
+{
+    using namespace aleatoric;
+
+    OsEntropySource source;
+
+    WHEN("Many seeds are requested")
+    {
+        std::set<std::uint64_t> seeds;
+        for(int i = 0; i < 1000; i++) {
+            seeds.insert(source.getSeed());
+        }
+
+        THEN("They are all different")
+        {
+            REQUIRE(seeds.size() == 1000);
+        }
+    }
+}
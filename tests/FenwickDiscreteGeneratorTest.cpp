@@ -0,0 +1,229 @@
+#include "FenwickDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("FenwickDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    FenwickDiscreteGenerator instance(
+        std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+        42);
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(5, 0);
+        for(int i = 0; i < 8000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2800);
+        REQUIRE(counts[2] < 3200);
+        REQUIRE(counts[3] > 3800);
+        REQUIRE(counts[3] < 4200);
+        REQUIRE(counts[4] == 0);
+    }
+
+    WHEN("Single weights are updated")
+    {
+        instance.updateDistributionVector(3, 0.0);
+        instance.updateDistributionVector(1, 4.0);
+
+        THEN("The numbers follow the updated distribution")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 4.0, 3.0, 0.0, 0.0});
+
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 8000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            REQUIRE(counts[0] > 850);
+            REQUIRE(counts[0] < 1150);
+            REQUIRE(counts[1] > 3800);
+            REQUIRE(counts[1] < 4200);
+            REQUIRE(counts[2] > 2800);
+            REQUIRE(counts[2] < 3200);
+            REQUIRE(counts[3] == 0);
+            REQUIRE(counts[4] == 0);
+        }
+    }
+
+    WHEN("A series is drawn by zeroing each number selected")
+    {
+        instance.setDistributionVector(1000, 1.0);
+
+        THEN("Every index is returned exactly once")
+        {
+            std::vector<int> counts(1000, 0);
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getNumber();
+                counts[number]++;
+                instance.updateDistributionVector(number, 0.0);
+            }
+
+            REQUIRE(counts == std::vector<int>(1000, 1));
+            REQUIRE(instance.getSupportSize() == 0);
+        }
+    }
+
+    WHEN("A series of weights that are not whole numbers is drawn")
+    {
+        instance.setDistributionVector(1000, 0.1);
+
+        THEN("Every index is returned exactly once, despite rounding errors")
+        {
+            std::vector<int> counts(1000, 0);
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getNumber();
+                counts[number]++;
+                instance.updateDistributionVector(number, 0.0);
+                REQUIRE(instance.getSupportSize() == 999 - i);
+            }
+
+            REQUIRE(counts == std::vector<int>(1000, 1));
+        }
+    }
+
+    WHEN("Weights of very different sizes are zeroed one at a time")
+    {
+        instance.setDistributionVector(
+            std::vector<double> {0.1, 1e16, 0.3, 0.3, 0.7});
+        for(int index : {1, 0, 2, 3, 4}) {
+            instance.updateDistributionVector(index, 0.0);
+        }
+
+        THEN("The rounding errors left in the sums are cleared, so every "
+             "index is equally likely")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 5000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 850);
+                REQUIRE(count < 1150);
+            }
+        }
+
+        AND_WHEN("A weight is then set")
+        {
+            instance.updateDistributionVector(2, 0.5);
+
+            THEN("Only that index is returned")
+            {
+                for(int i = 0; i < 100; i++) {
+                    REQUIRE(instance.getNumber() == 2);
+                }
+            }
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.updateDistributionVector(0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 500; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        FenwickDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("FenwickDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances constructed with the same seed and distribution")
+    {
+        FenwickDiscreteGenerator first(std::vector<double> {1.0, 2.0, 3.0},
+                                       42);
+        FenwickDiscreteGenerator second(std::vector<double> {1.0, 2.0, 3.0},
+                                        42);
+
+        THEN("They produce identical sequences")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == second.getNumber());
+            }
+        }
+    }
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        FenwickDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                FenwickDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("FenwickDiscreteGenerator: batches of numbers")
+{
+    using namespace aleatoric;
+
+    std::vector<double> distribution {1.0, 0.0, 3.0, 4.0};
+    FenwickDiscreteGenerator instance(distribution, 42);
+    FenwickDiscreteGenerator reference(distribution, 42);
+
+    // NB: larger than the block the unit numbers are generated in
+    std::vector<int> batch(1000);
+    instance.getNumbers(batch.data(), batch.size());
+
+    THEN("The batch matches requesting the numbers one at a time")
+    {
+        for(auto &&number : batch) {
+            REQUIRE(number == reference.getNumber());
+        }
+        REQUIRE(instance.getNumber() == reference.getNumber());
+    }
+}
@@ -5,6 +5,7 @@
 #include "UniformRealGenerator.hpp"
 
 #include <catch2/catch.hpp>
+#include <vector>
 
 SCENARIO("Numbers::GranularWalk: default constructor")
 {
@@ -323,3 +324,38 @@ SCENARIO("Numbers::GranularWalk: params")
         }
     }
 }
+
+SCENARIO("Numbers::GranularWalk: fill")
+{
+    using namespace aleatoric;
+
+    GranularWalk instance(std::make_unique<UniformRealGenerator>(42),
+                          Range(10, 20),
+                          0.1);
+    GranularWalk reference(std::make_unique<UniformRealGenerator>(42),
+                           Range(10, 20),
+                           0.1);
+
+    WHEN("A block of numbers is filled")
+    {
+        std::vector<double> block(1000);
+        instance.fill(block.data(), block.size());
+
+        THEN("It matches the same number of individual requests")
+        {
+            for(auto &&number : block) {
+                REQUIRE(number == reference.getDecimalNumber());
+            }
+        }
+
+        THEN("The walk continues from the end of the block")
+        {
+            for(size_t i = 0; i < block.size(); i++) {
+                reference.getDecimalNumber();
+            }
+
+            REQUIRE(instance.getDecimalNumber() ==
+                    reference.getDecimalNumber());
+        }
+    }
+}
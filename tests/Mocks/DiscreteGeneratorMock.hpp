@@ -14,6 +14,18 @@ class DiscreteGeneratorMock : public aleatoric::IDiscreteGenerator {
     MAKE_MOCK2(updateDistributionVector, void(int, double), override);
     MAKE_MOCK1(updateDistributionVector, void(double), override);
     MAKE_MOCK0(getDistributionVector, std::vector<double>(), override);
+    MAKE_MOCK1(discard, void(std::uint64_t), override);
+
+    // NB: reads through the mocked getDistributionVector, so that tests set
+    // their expectations on the distribution in one place
+    const std::vector<double> &viewDistributionVector() override
+    {
+        m_distributionVector = getDistributionVector();
+        return m_distributionVector;
+    }
+
+  private:
+    std::vector<double> m_distributionVector;
 };
 
 #endif /* DiscreteGeneratorMock_hpp */
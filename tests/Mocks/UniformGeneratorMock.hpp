@@ -9,7 +9,9 @@
 class UniformGeneratorMock : public aleatoric::IUniformGenerator {
   public:
     MAKE_MOCK0(getNumber, int(), override);
+    MAKE_MOCK2(getNumber, int(int, int), override);
     MAKE_MOCK2(setDistribution, void(int, int), override);
+    MAKE_MOCK1(discard, void(std::uint64_t), override);
 };
 
 #endif /* UniformGeneratorMock_hpp */
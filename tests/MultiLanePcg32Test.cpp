@@ -0,0 +1,57 @@
+#include "MultiLanePcg32.hpp"
+
+#include <catch2/catch.hpp>
+#include <vector>
+
+namespace {
+// reference implementation of a single pcg32 step, from the pcg paper
+std::uint32_t referenceNext(std::uint64_t &state, std::uint64_t increment)
+{
+    auto oldState = state;
+    state = oldState * 6364136223846793005ULL + increment;
+    auto xorshifted =
+        static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+    auto rotation = static_cast<std::uint32_t>(oldState >> 59u);
+    return (xorshifted >> rotation) | (xorshifted << ((-rotation) & 31u));
+}
+} // namespace
+
+SCENARIO("MultiLanePcg32")
+{
+    using namespace aleatoric;
+
+    std::uint64_t increment = (54u << 1u) | 1u;
+
+    THEN("Blocks of any size match the scalar pcg32 sequence and leave the "
+         "state after the last output")
+    {
+        // counts either side of multiples of the lane count
+        for(std::size_t count : {0, 1, 7, 8, 9, 255, 256, 1000}) {
+            std::uint64_t referenceState = 0x853c49e6748fea9bULL;
+            std::uint64_t laneState = referenceState;
+            std::uint64_t scalarState = referenceState;
+
+            std::vector<std::uint32_t> expected(count);
+            for(auto &&i : expected) {
+                i = referenceNext(referenceState, increment);
+            }
+
+            std::vector<std::uint32_t> lanes(count);
+            MultiLanePcg32::generate(laneState,
+                                     increment,
+                                     lanes.data(),
+                                     lanes.size());
+
+            std::vector<std::uint32_t> scalar(count);
+            MultiLanePcg32::generateScalar(scalarState,
+                                           increment,
+                                           scalar.data(),
+                                           scalar.size());
+
+            REQUIRE(lanes == expected);
+            REQUIRE(scalar == expected);
+            REQUIRE(laneState == referenceState);
+            REQUIRE(scalarState == referenceState);
+        }
+    }
+}
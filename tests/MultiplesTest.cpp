@@ -143,8 +143,8 @@ SCENARIO("TimeDomain::Multiples")
     {
         auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
-        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
-        ALLOW_CALL(*generatorPointer, getNumber()).RETURN(1);
+        ALLOW_CALL(*generatorPointer, getNumber(ANY(int), ANY(int)))
+            .RETURN(1);
 
         int baseIncrement = 100;
         double deviationFactor = 0.5;
@@ -167,8 +167,9 @@ SCENARIO("TimeDomain::Multiples")
 
         WHEN("Each duration is requested")
         {
-            THEN("The generator should be set with a range around the duration "
-                 "that matches the deviation factor supplied")
+            THEN("The generator should be asked for a number from a range "
+                 "around the duration that matches the deviation factor "
+                 "supplied")
             {
                 // for a range of 2-4 with a base increment of 100 and a
                 // deviation factor of 0.5, the generator ranges set should be:
@@ -177,9 +178,9 @@ SCENARIO("TimeDomain::Multiples")
                 // 300 = 150 - 450
                 // 400 = 200 - 600
 
-                REQUIRE_CALL(*generatorPointer, setDistribution(100, 300));
-                REQUIRE_CALL(*generatorPointer, setDistribution(150, 450));
-                REQUIRE_CALL(*generatorPointer, setDistribution(200, 600));
+                REQUIRE_CALL(*generatorPointer, getNumber(100, 300)).RETURN(1);
+                REQUIRE_CALL(*generatorPointer, getNumber(150, 450)).RETURN(1);
+                REQUIRE_CALL(*generatorPointer, getNumber(200, 600)).RETURN(1);
                 instance.getDuration(0);
                 instance.getDuration(1);
                 instance.getDuration(2);
@@ -188,7 +189,8 @@ SCENARIO("TimeDomain::Multiples")
             THEN("The generator should be called to select a number which "
                  "should be returned")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(123);
+                REQUIRE_CALL(*generatorPointer, getNumber(ANY(int), ANY(int)))
+                    .RETURN(123);
                 auto returnedNumber = instance.getDuration(0);
                 REQUIRE(returnedNumber == 123);
             }
@@ -202,7 +204,8 @@ SCENARIO("TimeDomain::Multiples")
 
                 auto roundingGen = std::make_unique<UniformGeneratorMock>();
                 auto roundingGenPointer = roundingGen.get();
-                ALLOW_CALL(*roundingGenPointer, getNumber()).RETURN(1);
+                ALLOW_CALL(*roundingGenPointer, getNumber(ANY(int), ANY(int)))
+                    .RETURN(1);
 
                 aleatoric::Range roundingRange(1, 3);
 
@@ -211,8 +214,9 @@ SCENARIO("TimeDomain::Multiples")
                                                    roundingDevF,
                                                    std::move(roundingGen));
 
-                THEN("The generator should be set with a range around the "
-                     "duration where the numbers have been correctly rounded")
+                THEN("The generator should be asked for a number from a range "
+                     "around the duration where the numbers have been "
+                     "correctly rounded")
                 {
                     // for a range of 1-3 with a base increment of 33 and a
                     // deviation factor of 0.3, the generator ranges set should
@@ -222,9 +226,12 @@ SCENARIO("TimeDomain::Multiples")
                     // 66 = (66 - 19.8 = 46.2 ~ 46) -> (66 + 19.8 = 85.8 ~ 86)
                     // 99 = (99 - 29.7 = 69.3 ~ 69) -> (99 + 29.7 = 128.7 ~ 129)
 
-                    REQUIRE_CALL(*roundingGenPointer, setDistribution(23, 43));
-                    REQUIRE_CALL(*roundingGenPointer, setDistribution(46, 86));
-                    REQUIRE_CALL(*roundingGenPointer, setDistribution(69, 129));
+                    REQUIRE_CALL(*roundingGenPointer, getNumber(23, 43))
+                        .RETURN(1);
+                    REQUIRE_CALL(*roundingGenPointer, getNumber(46, 86))
+                        .RETURN(1);
+                    REQUIRE_CALL(*roundingGenPointer, getNumber(69, 129))
+                        .RETURN(1);
                     roundingInstance.getDuration(0);
                     roundingInstance.getDuration(1);
                     roundingInstance.getDuration(2);
@@ -371,8 +378,8 @@ SCENARIO("TimeDomain::Multiples")
     {
         auto generator = std::make_unique<UniformGeneratorMock>();
         auto generatorPointer = generator.get();
-        ALLOW_CALL(*generatorPointer, setDistribution(ANY(int), ANY(int)));
-        ALLOW_CALL(*generatorPointer, getNumber()).RETURN(1);
+        ALLOW_CALL(*generatorPointer, getNumber(ANY(int), ANY(int)))
+            .RETURN(1);
 
         int baseIncrement = 100;
         double deviationFactor = 0.5;
@@ -395,8 +402,9 @@ SCENARIO("TimeDomain::Multiples")
 
         WHEN("Each duration is requested")
         {
-            THEN("The generator should be set with a range around the duration "
-                 "that matches the deviation factor supplied")
+            THEN("The generator should be asked for a number from a range "
+                 "around the duration that matches the deviation factor "
+                 "supplied")
             {
                 // for the given multiplier, with a base increment of 100 and a
                 // deviation factor of 0.5, the generator ranges set should be:
@@ -406,10 +414,10 @@ SCENARIO("TimeDomain::Multiples")
                 // 700 = 350 - 1050
                 // 900 = 450 - 1350
 
-                REQUIRE_CALL(*generatorPointer, setDistribution(150, 450));
-                REQUIRE_CALL(*generatorPointer, setDistribution(250, 750));
-                REQUIRE_CALL(*generatorPointer, setDistribution(350, 1050));
-                REQUIRE_CALL(*generatorPointer, setDistribution(450, 1350));
+                REQUIRE_CALL(*generatorPointer, getNumber(150, 450)).RETURN(1);
+                REQUIRE_CALL(*generatorPointer, getNumber(250, 750)).RETURN(1);
+                REQUIRE_CALL(*generatorPointer, getNumber(350, 1050)).RETURN(1);
+                REQUIRE_CALL(*generatorPointer, getNumber(450, 1350)).RETURN(1);
                 instance.getDuration(0);
                 instance.getDuration(1);
                 instance.getDuration(2);
@@ -419,7 +427,8 @@ SCENARIO("TimeDomain::Multiples")
             THEN("The generator should be called to select a number which "
                  "should be returned")
             {
-                REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(123);
+                REQUIRE_CALL(*generatorPointer, getNumber(ANY(int), ANY(int)))
+                    .RETURN(123);
                 auto returnedNumber = instance.getDuration(0);
                 REQUIRE(returnedNumber == 123);
             }
@@ -0,0 +1,67 @@
+#include "NumberProtocolState.hpp"
+
+#include <catch2/catch.hpp>
+#include <sstream>
+#include <stdexcept>
+
+SCENARIO("NumberProtocolState")
+{
+    using namespace aleatoric;
+
+    NumberProtocolState state;
+    state.haveRequestedFirstNumber = true;
+    state.lastNumber = 0.1 + 0.2;
+    state.counters = {3, -1};
+    state.distributions = {{0.0, 1.0, 1.0}, {}, {0.25}};
+
+    WHEN("The state is written to and read from a stream")
+    {
+        std::stringstream stream;
+        stream << state;
+
+        NumberProtocolState readState;
+        stream >> readState;
+
+        THEN("The state read matches the state written")
+        {
+            REQUIRE_FALSE(stream.fail());
+            REQUIRE(readState.haveRequestedFirstNumber);
+            REQUIRE(readState.lastNumber == state.lastNumber);
+            REQUIRE(readState.counters == state.counters);
+            REQUIRE(readState.distributions == state.distributions);
+        }
+    }
+
+    WHEN("A malformed state is read from a stream")
+    {
+        std::stringstream stream("1 0.5 2 3");
+
+        NumberProtocolState readState;
+        stream >> readState;
+
+        THEN("The stream fails and the state is unchanged")
+        {
+            REQUIRE(stream.fail());
+            REQUIRE_FALSE(readState.haveRequestedFirstNumber);
+            REQUIRE(readState.counters.empty());
+        }
+    }
+
+    WHEN("The state is checked against the shape of a protocol")
+    {
+        THEN("A matching shape is accepted")
+        {
+            REQUIRE_NOTHROW(state.checkMatches(2, {3, 0, 1}));
+        }
+
+        THEN("A shape that does not match throws an exception")
+        {
+            REQUIRE_THROWS_AS(state.checkMatches(1, {3, 0, 1}),
+                              std::invalid_argument);
+            REQUIRE_THROWS_AS(state.checkMatches(2, {3, 0}),
+                              std::invalid_argument);
+            REQUIRE_THROWS_AS(state.checkMatches(2, {3, 1, 1}),
+                              std::invalid_argument);
+        }
+    }
+}
@@ -2,12 +2,15 @@
 
 #include "AdjacentSteps.hpp"
 #include "Basic.hpp"
+#include "CounterEngine.hpp"
 #include "Cycle.hpp"
 #include "DiscreteGenerator.hpp"
+#include "Engine.hpp"
 #include "GranularWalk.hpp"
 #include "GroupedRepetition.hpp"
 #include "NoRepetition.hpp"
 #include "Periodic.hpp"
+#include "Ratio.hpp"
 #include "Serial.hpp"
 #include "UniformGenerator.hpp"
 #include "Walk.hpp"
@@ -15,8 +18,10 @@
 #include <algorithm> // std::adjacent_find, std::find
 #include <array>
 #include <catch2/catch.hpp>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 
 SCENARIO("Numbers: Using Basic")
 {
@@ -917,3 +922,392 @@ SCENARIO("Numbers: Change protocol")
         }
     }
 }
+
+SCENARIO("Numbers: Seeded protocols")
+{
+    using namespace aleatoric;
+
+    std::vector<NumberProtocol::Type> types {
+        NumberProtocol::Type::adjacentSteps,
+        NumberProtocol::Type::basic,
+        NumberProtocol::Type::granularWalk,
+        NumberProtocol::Type::groupedRepetition,
+        NumberProtocol::Type::noRepetition,
+        NumberProtocol::Type::periodic,
+        NumberProtocol::Type::precision,
+        NumberProtocol::Type::ratio,
+        NumberProtocol::Type::serial,
+        NumberProtocol::Type::subset,
+        NumberProtocol::Type::walk};
+
+    THEN("Producers using protocols of the same type and seed produce "
+         "identical collections")
+    {
+        for(auto &&type : types) {
+            NumbersProducer first(NumberProtocol::create(type, 42));
+            NumbersProducer second(NumberProtocol::create(type, 42));
+
+            REQUIRE(first.getIntegerCollection(1000) ==
+                    second.getIntegerCollection(1000));
+            REQUIRE(first.getDecimalCollection(1000) ==
+                    second.getDecimalCollection(1000));
+        }
+    }
+}
+
+SCENARIO("Numbers: Protocols sharing an engine")
+{
+    using namespace aleatoric;
+
+    auto engine = std::make_shared<Engine>(42);
+    NumbersProducer first(
+        NumberProtocol::create(NumberProtocol::Type::basic, engine));
+    NumbersProducer second(
+        NumberProtocol::create(NumberProtocol::Type::basic, engine));
+
+    THEN("Their interleaved draws match a single protocol seeded the same")
+    {
+        NumbersProducer reference(
+            NumberProtocol::create(NumberProtocol::Type::basic, 42));
+
+        for(int i = 0; i < 1000; i++) {
+            REQUIRE(first.getIntegerNumber() == reference.getIntegerNumber());
+            REQUIRE(second.getIntegerNumber() == reference.getIntegerNumber());
+        }
+    }
+}
+
+SCENARIO("Numbers: Checkpointing protocol and engine state")
+{
+    using namespace aleatoric;
+
+    std::vector<NumberProtocol::Type> types {
+        NumberProtocol::Type::adjacentSteps,
+        NumberProtocol::Type::basic,
+        NumberProtocol::Type::cycle,
+        NumberProtocol::Type::granularWalk,
+        NumberProtocol::Type::groupedRepetition,
+        NumberProtocol::Type::noRepetition,
+        NumberProtocol::Type::periodic,
+        NumberProtocol::Type::precision,
+        NumberProtocol::Type::ratio,
+        NumberProtocol::Type::serial,
+        NumberProtocol::Type::subset,
+        NumberProtocol::Type::walk};
+
+    THEN("A new producer restored from a checkpoint continues where the "
+         "original left off")
+    {
+        for(auto &&type : types) {
+            auto engine = std::make_shared<Engine>(42);
+            NumbersProducer original(NumberProtocol::create(type, engine));
+            original.getDecimalCollection(999);
+
+            auto engineState = engine->saveState();
+            auto protocolState = original.saveState();
+            auto expected = original.getDecimalCollection(1000);
+
+            auto newEngine = std::make_shared<Engine>(7);
+            NumbersProducer restored(NumberProtocol::create(type, newEngine));
+            restored.restoreState(protocolState);
+            newEngine->restoreState(engineState);
+
+            REQUIRE(restored.getDecimalCollection(1000) == expected);
+        }
+    }
+
+    WHEN("A serial protocol is checkpointed part way through a series")
+    {
+        auto engine = std::make_shared<Engine>(42);
+        auto makeProtocol = [&engine]() {
+            return std::make_unique<Serial>(
+                std::make_unique<DiscreteGenerator>(engine),
+                Range(1, 10));
+        };
+
+        NumbersProducer original(makeProtocol());
+        original.getIntegerCollection(4);
+        auto engineState = engine->saveState();
+        auto protocolState = original.saveState();
+        auto expected = original.getIntegerCollection(6);
+
+        NumbersProducer restored(makeProtocol());
+        restored.restoreState(protocolState);
+        engine->restoreState(engineState);
+
+        THEN("The restored protocol completes the same series")
+        {
+            REQUIRE(restored.getIntegerCollection(6) == expected);
+        }
+    }
+
+    WHEN("A state from a protocol with a different range is restored")
+    {
+        NumbersProducer serial(std::make_unique<Serial>(
+            std::make_unique<DiscreteGenerator>(),
+            Range(1, 10)));
+        NumbersProducer otherSerial(std::make_unique<Serial>(
+            std::make_unique<DiscreteGenerator>(),
+            Range(1, 5)));
+
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(serial.restoreState(otherSerial.saveState()),
+                              std::invalid_argument);
+        }
+    }
+
+    WHEN("A state whose last number is outside the range is restored")
+    {
+        std::vector<NumberProtocol::Type> lastNumberTypes {
+            NumberProtocol::Type::adjacentSteps,
+            NumberProtocol::Type::granularWalk,
+            NumberProtocol::Type::noRepetition,
+            NumberProtocol::Type::periodic,
+            NumberProtocol::Type::walk};
+
+        THEN("An exception is thrown for each protocol that keeps one")
+        {
+            for(auto &&type : lastNumberTypes) {
+                auto instance = NumberProtocol::create(type);
+                instance->getIntegerNumber();
+                auto state = instance->saveState();
+                state.lastNumber = 1000;
+
+                REQUIRE_THROWS_AS(instance->restoreState(state),
+                                  std::invalid_argument);
+            }
+        }
+    }
+
+    WHEN("A grouped repetition state whose current number is outside the "
+         "range is restored")
+    {
+        auto instance =
+            NumberProtocol::create(NumberProtocol::Type::groupedRepetition);
+        auto state = instance->saveState();
+        state.counters = {1, 1000};
+
+        THEN("An exception is thrown")
+        {
+            REQUIRE_THROWS_AS(instance->restoreState(state),
+                              std::invalid_argument);
+        }
+    }
+
+    WHEN("A state is saved after a new range leaves the last number outside "
+         "it")
+    {
+        THEN("It is restored as if no number had been returned")
+        {
+            for(auto &&type : types) {
+                auto engine = std::make_shared<Engine>(42);
+                auto original = NumberProtocol::create(type, engine);
+                original->getIntegerNumber();
+                NumberProtocolConfig params(Range(100, 101),
+                                            original->getParams().protocols);
+                original->setParams(params);
+
+                auto engineState = engine->saveState();
+                auto protocolState = original->saveState();
+                auto expected = original->getIntegerNumber();
+
+                auto newEngine = std::make_shared<Engine>(7);
+                auto restored = NumberProtocol::create(type, newEngine);
+                restored->setParams(params);
+                restored->restoreState(protocolState);
+                newEngine->restoreState(engineState);
+
+                REQUIRE(restored->getIntegerNumber() == expected);
+            }
+        }
+    }
+}
+
+SCENARIO("Numbers: Counter based protocols")
+{
+    using namespace aleatoric;
+
+    std::vector<NumberProtocol::Type> types {NumberProtocol::Type::basic,
+                                             NumberProtocol::Type::precision};
+
+    THEN("A null engine selects the create() overload for Engine")
+    {
+        REQUIRE_THROWS_AS(
+            NumberProtocol::create(NumberProtocol::Type::basic, nullptr),
+            std::invalid_argument);
+    }
+
+    THEN("A null engine is rejected even by a protocol that draws nothing "
+         "from it")
+    {
+        REQUIRE_THROWS_AS(
+            NumberProtocol::create(NumberProtocol::Type::cycle,
+                                   std::shared_ptr<Engine>()),
+            std::invalid_argument);
+    }
+
+    THEN("Any number of the sequence can be reached directly")
+    {
+        for(auto &&type : types) {
+            auto engine = std::make_shared<CounterEngine>(42);
+            NumbersProducer instance(
+                NumberProtocol::createCounterBased(type, engine));
+            auto sequence = instance.getIntegerCollection(1000);
+
+            engine->setPosition(500);
+            REQUIRE(instance.getIntegerCollection(500) ==
+                    std::vector<int>(sequence.begin() + 500, sequence.end()));
+        }
+    }
+
+    THEN("Other protocol types cannot be created with a counter engine")
+    {
+        auto engine = std::make_shared<CounterEngine>(42);
+        REQUIRE_THROWS_AS(
+            NumberProtocol::createCounterBased(NumberProtocol::Type::walk,
+                                               engine),
+            std::invalid_argument);
+    }
+}
+
+SCENARIO("Numbers: Discarding numbers")
+{
+    using namespace aleatoric;
+
+    std::vector<NumberProtocol::Type> types {
+        NumberProtocol::Type::adjacentSteps,
+        NumberProtocol::Type::basic,
+        NumberProtocol::Type::cycle,
+        NumberProtocol::Type::granularWalk,
+        NumberProtocol::Type::groupedRepetition,
+        NumberProtocol::Type::noRepetition,
+        NumberProtocol::Type::periodic,
+        NumberProtocol::Type::precision,
+        NumberProtocol::Type::ratio,
+        NumberProtocol::Type::serial,
+        NumberProtocol::Type::subset,
+        NumberProtocol::Type::walk};
+
+    THEN("Discarding matches requesting the same number of numbers")
+    {
+        for(auto &&type : types) {
+            for(int count : {1, 9, 1000}) {
+                NumbersProducer instance(NumberProtocol::create(type, 42));
+                NumbersProducer reference(NumberProtocol::create(type, 42));
+                instance.getDecimalCollection(5);
+                reference.getDecimalCollection(5);
+
+                instance.discard(count);
+                reference.getDecimalCollection(count);
+
+                REQUIRE(instance.getDecimalCollection(1000) ==
+                        reference.getDecimalCollection(1000));
+            }
+        }
+    }
+
+    WHEN("Series based protocols discard from part way through a series")
+    {
+        std::vector<std::function<std::unique_ptr<NumberProtocol>()>>
+            makeProtocols {
+                []() {
+                    return std::make_unique<Serial>(
+                        std::make_unique<DiscreteGenerator>(42),
+                        Range(1, 10));
+                },
+                []() {
+                    return std::make_unique<Ratio>(
+                        std::make_unique<DiscreteGenerator>(42),
+                        Range(1, 3),
+                        std::vector<int> {3, 1, 2});
+                }};
+
+        THEN("They match requesting the same number of numbers")
+        {
+            for(auto &&makeProtocol : makeProtocols) {
+                for(int count = 0; count < 25; count++) {
+                    NumbersProducer instance(makeProtocol());
+                    NumbersProducer reference(makeProtocol());
+                    instance.getIntegerCollection(4);
+                    reference.getIntegerCollection(4);
+
+                    instance.discard(count);
+                    reference.getIntegerCollection(count);
+
+                    REQUIRE(instance.getIntegerCollection(100) ==
+                            reference.getIntegerCollection(100));
+                }
+            }
+        }
+    }
+
+    WHEN("Counter based protocols discard numbers")
+    {
+        auto engine = std::make_shared<CounterEngine>(42);
+        NumbersProducer instance(NumberProtocol::createCounterBased(
+            NumberProtocol::Type::precision,
+            engine));
+
+        instance.discard(1000);
+
+        THEN("The engine position moves on by the same number")
+        {
+            REQUIRE(engine->getPosition() == 1000);
+        }
+    }
+}
+
+SCENARIO("Numbers: Collections")
+{
+    using namespace aleatoric;
+
+    std::vector<NumberProtocol::Type> types {
+        NumberProtocol::Type::adjacentSteps,
+        NumberProtocol::Type::basic,
+        NumberProtocol::Type::cycle,
+        NumberProtocol::Type::groupedRepetition,
+        NumberProtocol::Type::noRepetition,
+        NumberProtocol::Type::periodic,
+        NumberProtocol::Type::precision,
+        NumberProtocol::Type::ratio,
+        NumberProtocol::Type::serial,
+        NumberProtocol::Type::subset};
+
+    THEN("A collection matches requesting the same numbers one at a time")
+    {
+        for(auto &&type : types) {
+            NumbersProducer instance(NumberProtocol::create(type, 42));
+            NumbersProducer reference(NumberProtocol::create(type, 42));
+
+            auto collection = instance.getIntegerCollection(1000);
+
+            for(auto &&number : collection) {
+                REQUIRE(number == reference.getIntegerNumber());
+            }
+        }
+    }
+
+    WHEN("The range does not start at 0")
+    {
+        NumberProtocolConfig params(
+            Range(5, 8),
+            NumberProtocolParams(PrecisionParams({0.1, 0.2, 0.3, 0.4})));
+
+        NumbersProducer instance(
+            NumberProtocol::create(NumberProtocol::Type::precision, 42));
+        NumbersProducer reference(
+            NumberProtocol::create(NumberProtocol::Type::precision, 42));
+        instance.setParams(params);
+        reference.setParams(params);
+
+        auto collection = instance.getIntegerCollection(1000);
+
+        THEN("The collection is offset as the numbers requested singly")
+        {
+            for(auto &&number : collection) {
+                REQUIRE(number == reference.getIntegerNumber());
+            }
+        }
+    }
+}
@@ -131,7 +131,10 @@ SCENARIO("Numbers::Periodic")
             .RETURN(initialGeneratorDistributionState);
         ALLOW_CALL(*generatorPointer,
                    setDistributionVector(ANY(std::vector<double>)));
-        ALLOW_CALL(*generatorPointer, setDistributionVector(ANY(int), 1.0));
+        ALLOW_CALL(*generatorPointer,
+                   setDistributionVector(ANY(int), ANY(double)));
+        ALLOW_CALL(*generatorPointer,
+                   updateDistributionVector(ANY(int), ANY(double)));
 
         Range range(1, 3);
 
@@ -172,10 +175,12 @@ SCENARIO("Numbers::Periodic")
                 // have to be careful what numbers to choose here to demonstrate
                 // that this logic is fundamentally correct. See note in
                 // setPeriodicDistribution()
+                REQUIRE_CALL(*generatorPointer,
+                             setDistributionVector(range.size, 0.25));
                 REQUIRE_CALL(
                     *generatorPointer,
-                    setDistributionVector(
-                        std::vector<double> {0.25, chanceOfRepetition, 0.25}));
+                    updateDistributionVector(generatedNumber,
+                                             chanceOfRepetition));
                 instance.getIntegerNumber();
             }
         }
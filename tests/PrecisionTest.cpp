@@ -1,5 +1,6 @@
 #include "Precision.hpp"
 
+#include "AliasDiscreteGenerator.hpp"
 #include "DiscreteGenerator.hpp"
 #include "DiscreteGeneratorMock.hpp"
 #include "NumberProtocolParameters.hpp"
@@ -185,3 +186,50 @@ SCENARIO("Numbers:Precision: params")
         }
     }
 }
+
+SCENARIO("Numbers::Precision: cached alias tables")
+{
+    using namespace aleatoric;
+
+    auto generator = std::make_unique<AliasDiscreteGenerator>(
+        std::vector<double> {0.5, 0.5},
+        42);
+    generator->setTableCacheCapacity(4);
+    auto generatorPointer = generator.get();
+    Precision instance(std::move(generator));
+
+    NumberProtocolConfig first(
+        Range(1, 4),
+        NumberProtocolParams(PrecisionParams({0.1, 0.2, 0.3, 0.4})));
+    NumberProtocolConfig second(
+        Range(1, 3),
+        NumberProtocolParams(PrecisionParams({0.5, 0.0, 0.5})));
+
+    WHEN("The params return to a distribution used before")
+    {
+        instance.setParams(first);
+        instance.setParams(second);
+        auto tablesBuilt = generatorPointer->getTableCacheSize();
+        instance.setParams(first);
+
+        THEN("Its table is reused rather than rebuilt")
+        {
+            REQUIRE(generatorPointer->getTableCacheSize() == tablesBuilt);
+        }
+
+        THEN("The numbers are as from a table built afresh")
+        {
+            Precision reference(
+                std::make_unique<AliasDiscreteGenerator>(
+                    std::vector<double> {0.5, 0.5},
+                    42),
+                Range(1, 4),
+                {0.1, 0.2, 0.3, 0.4});
+
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getIntegerNumber() ==
+                        reference.getIntegerNumber());
+            }
+        }
+    }
+}
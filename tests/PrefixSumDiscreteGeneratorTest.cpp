@@ -0,0 +1,194 @@
+#include "PrefixSumDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+#include "PrefixSumSearch.hpp"
+
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("PrefixSumSearch")
+{
+    using namespace aleatoric;
+
+    Engine engine(42);
+
+    THEN("The sums and searches match the scalar implementation for any "
+         "size")
+    {
+        // sizes either side of multiples of the scan and block widths
+        for(std::size_t size : {0, 1, 3, 4, 5, 7, 8, 9, 16, 100, 1024}) {
+            std::vector<double> weights(size);
+            for(auto &&weight : weights) {
+                // some zero weights, which the search must pass over
+                weight = std::floor(engine.getUnitNumber() * 4.0) * 0.37;
+            }
+
+            auto paddedSize = PrefixSumSearch::getPaddedSize(size);
+            REQUIRE(paddedSize % PrefixSumSearch::blockSize == 0);
+            REQUIRE(paddedSize >= size);
+
+            std::vector<float> sums(paddedSize);
+            std::vector<float> scalarSums(paddedSize);
+            PrefixSumSearch::build(weights.data(), size, sums.data());
+            PrefixSumSearch::buildScalar(weights.data(),
+                                         size,
+                                         scalarSums.data());
+
+            REQUIRE(sums == scalarSums);
+            for(auto i = size; i < paddedSize; i++) {
+                REQUIRE(std::isinf(sums[i]));
+            }
+
+            double total = 0.0;
+            for(std::size_t i = 0; i < size; i++) {
+                total += weights[i];
+                REQUIRE(sums[i] == Approx(total));
+            }
+
+            for(int i = 0; i < 200; i++) {
+                auto target = static_cast<float>(engine.getUnitNumber() *
+                                                 (total + 1.0));
+                REQUIRE(PrefixSumSearch::count(sums.data(),
+                                               paddedSize,
+                                               target) ==
+                        PrefixSumSearch::countScalar(sums.data(),
+                                                     paddedSize,
+                                                     target));
+            }
+        }
+    }
+}
+
+SCENARIO("PrefixSumDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    PrefixSumDiscreteGenerator instance(
+        std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+        42);
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(5, 0);
+        for(int i = 0; i < 8000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2800);
+        REQUIRE(counts[2] < 3200);
+        REQUIRE(counts[3] > 3800);
+        REQUIRE(counts[3] < 4200);
+        REQUIRE(counts[4] == 0);
+    }
+
+    WHEN("The distribution is updated between numbers")
+    {
+        std::vector<int> counts(64, 0);
+        instance.setDistributionVector(64, 0.0);
+
+        for(int i = 0; i < 6400; i++) {
+            auto step = i % 64;
+            instance.beginDistributionUpdate();
+            instance.updateDistributionVector(0.0);
+            instance.updateDistributionVector(step, 1.0);
+            instance.updateDistributionVector(63 - step, 1.0);
+            instance.commitDistributionUpdate();
+
+            auto number = instance.getNumber();
+            REQUIRE((number == step || number == 63 - step));
+            counts[number]++;
+        }
+
+        THEN("Every index is returned")
+        {
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.updateDistributionVector(0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 500; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("Numbers are requested in a batch")
+    {
+        PrefixSumDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+            42);
+
+        std::vector<int> batch(1000);
+        instance.getNumbers(batch.data(), batch.size());
+
+        THEN("They match numbers requested one at a time")
+        {
+            for(auto &&number : batch) {
+                REQUIRE(number == reference.getNumber());
+            }
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        PrefixSumDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("PrefixSumDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        PrefixSumDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                PrefixSumDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
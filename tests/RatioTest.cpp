@@ -1,7 +1,9 @@
 #include "Ratio.hpp"
 
+#include "CountedDiscreteGenerator.hpp"
 #include "DiscreteGenerator.hpp"
 #include "DiscreteGeneratorMock.hpp"
+#include "Engine.hpp"
 #include "Range.hpp"
 
 #include <catch2/catch.hpp>
@@ -83,15 +85,15 @@ SCENARIO("Numbers::Ratio")
 
         // 3 numbers because the range is inclusive
         std::vector<int> ratios {1, 2, 3};
-        int ratiosSum = 6;
 
         WHEN("The constructor is called")
         {
-            THEN("The generator should be set to the size of the sum of the "
-                 "ratios supplied with equal probability")
+            THEN("The generator weights should be set to the ratios supplied, "
+                 "as the counts of each number in a series")
             {
-                REQUIRE_CALL(*generatorPointer,
-                             setDistributionVector(ratiosSum, 1.0));
+                REQUIRE_CALL(
+                    *generatorPointer,
+                    setDistributionVector(std::vector<double> {1.0, 2.0, 3.0}));
                 Ratio(std::move(generator), Range(10, 12), ratios);
             }
         }
@@ -103,12 +105,12 @@ SCENARIO("Numbers::Ratio")
         auto generatorPointer = generator.get();
         ALLOW_CALL(*generatorPointer, getNumber()).RETURN(1);
         ALLOW_CALL(*generatorPointer,
-                   setDistributionVector(ANY(int), ANY(double)));
+                   setDistributionVector(ANY(std::vector<double>)));
         ALLOW_CALL(*generatorPointer,
                    updateDistributionVector(ANY(int), ANY(double)));
-        // ensures that seriesIsComplete returns true
+        // ensures that the series is part way through, so is not complete
         ALLOW_CALL(*generatorPointer, getDistributionVector())
-            .RETURN(std::vector<double> {1.0});
+            .RETURN(std::vector<double> {1.0, 3.0, 5.0});
 
         Range range(10, 12);
 
@@ -125,8 +127,8 @@ SCENARIO("Numbers::Ratio")
                 instance.getIntegerNumber();
             }
 
-            THEN("It updates the generator to disallow the selected number "
-                 "from being selected in future calls")
+            THEN("It reduces the count of the selected number by one, so that "
+                 "it is selected as many times in a series as its ratio")
             {
                 int generatedNumber = 1;
 
@@ -134,46 +136,44 @@ SCENARIO("Numbers::Ratio")
                     .RETURN(generatedNumber);
 
                 REQUIRE_CALL(*generatorPointer,
-                             updateDistributionVector(generatedNumber, 0.0));
+                             updateDistributionVector(generatedNumber, 2.0));
 
                 instance.getIntegerNumber();
             }
 
-            THEN("It returns the number held within the selectables collection "
-                 "at the index specified by the generated number")
+            THEN("It returns the number in the range at the index specified by "
+                 "the generated number")
             {
-                std::vector<int>
-                    expectedSelectables {10, 11, 11, 11, 12, 12, 12, 12, 12};
-
-                // get generator to return numbers for each index in
-                // expectedSelectables
-                for(int i = 0; i < expectedSelectables.size(); i++) {
+                for(int i = 0; i < range.size; i++) {
                     REQUIRE_CALL(*generatorPointer, getNumber()).RETURN(i);
 
                     auto returnedNumber = instance.getIntegerNumber();
 
-                    REQUIRE(returnedNumber == expectedSelectables[i]);
+                    REQUIRE(returnedNumber == range.start + i);
                 }
             }
 
             THEN("It gets the state of the generator distribution for "
                  "determining if the series is complete")
             {
-                // NB: the return value for this test can be anything
                 REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                    .RETURN(std::vector<double> {1.0});
+                    .TIMES(AT_LEAST(1))
+                    .RETURN(std::vector<double> {1.0, 3.0, 5.0});
                 instance.getIntegerNumber();
             }
 
             AND_WHEN("The series is complete")
             {
-                THEN("It resets the generator distribution")
+                THEN("It resets the generator distribution to the ratios")
                 {
                     REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                        .RETURN(std::vector<double> {0.0});
+                        .TIMES(AT_LEAST(1))
+                        .RETURN(std::vector<double> {0.0, 0.0, 0.0});
 
-                    REQUIRE_CALL(*generatorPointer,
-                                 updateDistributionVector(1.0));
+                    REQUIRE_CALL(
+                        *generatorPointer,
+                        setDistributionVector(
+                            std::vector<double> {1.0, 3.0, 5.0}));
 
                     instance.getIntegerNumber();
                 }
@@ -184,10 +184,12 @@ SCENARIO("Numbers::Ratio")
                 THEN("It does not reset the generator distribution")
                 {
                     REQUIRE_CALL(*generatorPointer, getDistributionVector())
-                        .RETURN(std::vector<double> {1.0});
+                        .TIMES(AT_LEAST(1))
+                        .RETURN(std::vector<double> {1.0, 3.0, 5.0});
 
                     FORBID_CALL(*generatorPointer,
-                                updateDistributionVector(1.0));
+                                setDistributionVector(
+                                    ANY(std::vector<double>)));
 
                     instance.getIntegerNumber();
                 }
@@ -275,4 +277,62 @@ SCENARIO("Numbers::Ratio: params")
                               std::invalid_argument);
         }
     }
+
+    WHEN("set params: a ratio is negative")
+    {
+        Range newRange(4, 6);
+        std::vector<int> newRatios {2, -1, 3};
+        NumberProtocolConfig newParams(
+            newRange,
+            NumberProtocolParams(RatioParams(newRatios)));
+
+        THEN("Throw exception and leave the object unchanged")
+        {
+            REQUIRE_THROWS_AS(instance.setParams(newParams),
+                              std::invalid_argument);
+
+            auto params = instance.getParams();
+            REQUIRE(params.getRange().start == 1);
+            REQUIRE(params.protocols.getRatio().getRatios() == ratios);
+        }
+    }
+
+    WHEN("set params: every ratio is zero")
+    {
+        Range newRange(4, 6);
+        std::vector<int> newRatios {0, 0, 0};
+        NumberProtocolConfig newParams(
+            newRange,
+            NumberProtocolParams(RatioParams(newRatios)));
+
+        THEN("Throw exception")
+        {
+            REQUIRE_THROWS_AS(instance.setParams(newParams),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Numbers::Ratio: large ratios")
+{
+    using namespace aleatoric;
+
+    std::vector<int> ratios {10000, 3, 250};
+    Ratio instance(std::make_unique<CountedDiscreteGenerator>(
+                       std::make_shared<Engine>(42)),
+                   Range(0, 2),
+                   ratios);
+
+    WHEN("A whole series is requested")
+    {
+        std::vector<int> counts(3, 0);
+        for(int i = 0; i < 10253; i++) {
+            counts[instance.getIntegerNumber()]++;
+        }
+
+        THEN("Each number is returned as many times as its ratio")
+        {
+            REQUIRE(counts == ratios);
+        }
+    }
 }
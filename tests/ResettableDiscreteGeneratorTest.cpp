@@ -0,0 +1,190 @@
+#include "ResettableDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("ResettableDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    ResettableDiscreteGenerator instance(
+        std::vector<double> {1.0, 0.0, 3.0, 4.0, 1.0},
+        42);
+
+    THEN("The distribution vector is as set")
+    {
+        REQUIRE(instance.getDistributionVector() ==
+                std::vector<double> {1.0, 0.0, 3.0, 4.0, 1.0});
+    }
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(5, 0);
+        for(int i = 0; i < 9000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2800);
+        REQUIRE(counts[2] < 3200);
+        REQUIRE(counts[3] > 3800);
+        REQUIRE(counts[3] < 4200);
+        REQUIRE(counts[4] > 850);
+        REQUIRE(counts[4] < 1150);
+    }
+
+    WHEN("The distribution is viewed after an update and a reset")
+    {
+        instance.updateDistributionVector(1, 2.0);
+        auto updated = instance.viewDistributionVector();
+        instance.updateDistributionVector(0.5);
+
+        THEN("Each view is built from the weights at that time")
+        {
+            REQUIRE(updated == std::vector<double> {1.0, 2.0, 3.0, 4.0, 1.0});
+            REQUIRE(instance.viewDistributionVector() ==
+                    std::vector<double>(5, 0.5));
+        }
+    }
+
+    WHEN("The weights are reset to a uniform value")
+    {
+        instance.updateDistributionVector(2.0);
+
+        THEN("Every weight has that value")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double>(5, 2.0));
+
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 5000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 850);
+                REQUIRE(count < 1150);
+            }
+        }
+    }
+
+    WHEN("The weights are reset and one is then excluded")
+    {
+        THEN("That number is never returned next")
+        {
+            auto number = instance.getNumber();
+            for(int i = 0; i < 1000; i++) {
+                instance.updateDistributionVector(1.0);
+                instance.updateDistributionVector(number, 0.0);
+
+                auto nextNumber = instance.getNumber();
+                REQUIRE(nextNumber != number);
+                number = nextNumber;
+            }
+        }
+    }
+
+    WHEN("The weights are reset to zero and a few are then set")
+    {
+        instance.setDistributionVector(1000, 1.0);
+        instance.updateDistributionVector(0.0);
+        instance.updateDistributionVector(500, 1.0);
+        instance.updateDistributionVector(502, 1.0);
+        instance.updateDistributionVector(502, 3.0);
+
+        THEN("Only those numbers are returned, following their weights")
+        {
+            std::vector<int> counts(1000, 0);
+            for(int i = 0; i < 4000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            REQUIRE(counts[500] + counts[502] == 4000);
+            REQUIRE(counts[500] > 850);
+            REQUIRE(counts[500] < 1150);
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.updateDistributionVector(0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 500; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        ResettableDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 1.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("ResettableDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances constructed with the same seed and distribution")
+    {
+        ResettableDiscreteGenerator first(std::vector<double> {1.0, 2.0, 3.0},
+                                          42);
+        ResettableDiscreteGenerator second(std::vector<double> {1.0, 2.0, 3.0},
+                                           42);
+
+        THEN("They produce identical sequences")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == second.getNumber());
+            }
+        }
+    }
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        ResettableDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                ResettableDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
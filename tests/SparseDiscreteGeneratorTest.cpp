@@ -0,0 +1,216 @@
+#include "SparseDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("SparseDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    SparseDiscreteGenerator instance(
+        std::vector<double> {1.0, 0.0, 1.0, 5.0, 1.0},
+        42);
+
+    THEN("The distribution is as set")
+    {
+        REQUIRE(instance.getDistributionVector() ==
+                std::vector<double> {1.0, 0.0, 1.0, 5.0, 1.0});
+        REQUIRE(instance.getDistributionSize() == 5);
+        REQUIRE(instance.getSupportSize() == 4);
+    }
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(5, 0);
+        for(int i = 0; i < 8000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 850);
+        REQUIRE(counts[2] < 1150);
+        REQUIRE(counts[3] > 4800);
+        REQUIRE(counts[3] < 5200);
+        REQUIRE(counts[4] > 850);
+        REQUIRE(counts[4] < 1150);
+    }
+
+    WHEN("An index is set back to the base weight")
+    {
+        instance.updateDistributionVector(3, 1.0);
+
+        THEN("The distribution reflects it")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 0.0, 1.0, 1.0, 1.0});
+            REQUIRE(instance.getSupportSize() == 4);
+        }
+    }
+
+    WHEN("The base weight is zero")
+    {
+        instance.setDistributionVector(5, 0.0);
+        instance.updateDistributionVector(1, 2.0);
+        instance.updateDistributionVector(4, 2.0);
+
+        THEN("Only the exceptions are returned")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 1000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            REQUIRE(counts[0] == 0);
+            REQUIRE(counts[1] > 400);
+            REQUIRE(counts[2] == 0);
+            REQUIRE(counts[3] == 0);
+            REQUIRE(counts[4] > 400);
+            REQUIRE(instance.getSupportSize() == 2);
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.updateDistributionVector(0.0);
+
+        THEN("Every index can be returned")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 500; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        SparseDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 1.0, 5.0, 1.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("SparseDiscreteGenerator: a large distribution")
+{
+    using namespace aleatoric;
+
+    SparseDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+    int size = 2000000;
+    instance.setDistributionVector(size, 1.0);
+    instance.updateDistributionVector(0, 0.0);
+    instance.updateDistributionVector(1000, 0.0);
+    instance.updateDistributionVector(size - 1, 0.0);
+
+    THEN("Its size is read without building it")
+    {
+        REQUIRE(instance.getDistributionSize() == 2000000);
+        REQUIRE(instance.getSupportSize() == 1999997);
+    }
+
+    THEN("The indices weighted zero are never returned")
+    {
+        for(int i = 0; i < 100000; i++) {
+            auto number = instance.getNumber();
+            REQUIRE(number > 0);
+            REQUIRE(number != 1000);
+            REQUIRE(number < size - 1);
+        }
+    }
+
+    THEN("Numbers are spread across the range")
+    {
+        std::vector<int> counts(4, 0);
+        for(int i = 0; i < 40000; i++) {
+            counts[instance.getNumber() / (size / 4)]++;
+        }
+
+        for(auto &&count : counts) {
+            REQUIRE(count > 9500);
+            REQUIRE(count < 10500);
+        }
+    }
+}
+
+SCENARIO("SparseDiscreteGenerator: a distribution differing only at index 0")
+{
+    using namespace aleatoric;
+
+    std::vector<double> distribution(100000, 1.0);
+    distribution[0] = 0.0;
+    SparseDiscreteGenerator instance(distribution, 42);
+
+    THEN("The distribution is as set")
+    {
+        REQUIRE(instance.getDistributionVector() == distribution);
+        REQUIRE(instance.getDistributionSize() == 100000);
+        REQUIRE(instance.getSupportSize() == 99999);
+    }
+
+    THEN("Index 0 is never returned")
+    {
+        for(int i = 0; i < 10000; i++) {
+            REQUIRE(instance.getNumber() != 0);
+        }
+    }
+
+    WHEN("Index 0 is set back to the weight of the others")
+    {
+        instance.updateDistributionVector(0, 1.0);
+
+        THEN("Every index has the same weight")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double>(100000, 1.0));
+            REQUIRE(instance.getSupportSize() == 100000);
+        }
+    }
+}
+
+SCENARIO("SparseDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        SparseDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                SparseDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,200 @@
+#include "SupportListDiscreteGenerator.hpp"
+
+#include "Engine.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO("SupportListDiscreteGenerator")
+{
+    using namespace aleatoric;
+
+    SupportListDiscreteGenerator instance(
+        std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+        42);
+
+    THEN("The support holds the weights above zero")
+    {
+        REQUIRE(instance.getSupportSize() == 3);
+    }
+
+    THEN("Numbers follow the distribution")
+    {
+        std::vector<int> counts(5, 0);
+        for(int i = 0; i < 8000; i++) {
+            counts[instance.getNumber()]++;
+        }
+
+        REQUIRE(counts[0] > 850);
+        REQUIRE(counts[0] < 1150);
+        REQUIRE(counts[1] == 0);
+        REQUIRE(counts[2] > 2800);
+        REQUIRE(counts[2] < 3200);
+        REQUIRE(counts[3] > 3800);
+        REQUIRE(counts[3] < 4200);
+        REQUIRE(counts[4] == 0);
+    }
+
+    WHEN("Single weights are updated")
+    {
+        instance.updateDistributionVector(3, 0.0);
+        instance.updateDistributionVector(1, 4.0);
+
+        THEN("The numbers follow the updated distribution")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 4.0, 3.0, 0.0, 0.0});
+            REQUIRE(instance.getSupportSize() == 3);
+
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 8000; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            REQUIRE(counts[0] > 850);
+            REQUIRE(counts[0] < 1150);
+            REQUIRE(counts[1] > 3800);
+            REQUIRE(counts[1] < 4200);
+            REQUIRE(counts[2] > 2800);
+            REQUIRE(counts[2] < 3200);
+            REQUIRE(counts[3] == 0);
+            REQUIRE(counts[4] == 0);
+        }
+    }
+
+    WHEN("A series is drawn by zeroing each number selected")
+    {
+        instance.setDistributionVector(1000, 1.0);
+
+        THEN("Every index is returned exactly once")
+        {
+            std::vector<int> counts(1000, 0);
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getNumber();
+                counts[number]++;
+                instance.updateDistributionVector(number, 0.0);
+            }
+
+            REQUIRE(counts == std::vector<int>(1000, 1));
+            REQUIRE(instance.getSupportSize() == 0);
+        }
+    }
+
+    WHEN("The series is nearly depleted")
+    {
+        instance.setDistributionVector(1000, 1.0);
+        for(int i = 0; i < 1000; i++) {
+            if(i != 10 && i != 500) {
+                instance.updateDistributionVector(i, 0.0);
+            }
+        }
+
+        THEN("Only the numbers left are returned, with equal probability")
+        {
+            int tens = 0;
+            for(int i = 0; i < 2000; i++) {
+                auto number = instance.getNumber();
+                REQUIRE((number == 10 || number == 500));
+                tens += number == 10;
+            }
+
+            REQUIRE(tens > 900);
+            REQUIRE(tens < 1100);
+        }
+    }
+
+    WHEN("Every weight is zero")
+    {
+        instance.updateDistributionVector(0.0);
+
+        THEN("Every index can be returned")
+        {
+            REQUIRE(instance.getSupportSize() == 0);
+
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 500; i++) {
+                counts[instance.getNumber()]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 0);
+            }
+        }
+
+        AND_WHEN("A weight is then set")
+        {
+            instance.updateDistributionVector(2, 5.0);
+
+            THEN("Only that index is returned")
+            {
+                for(int i = 0; i < 100; i++) {
+                    REQUIRE(instance.getNumber() == 2);
+                }
+            }
+        }
+    }
+
+    WHEN("Numbers are discarded")
+    {
+        SupportListDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+            42);
+
+        instance.discard(1000);
+        for(int i = 0; i < 1000; i++) {
+            reference.getNumber();
+        }
+
+        THEN("The numbers that follow match the reference")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber() == reference.getNumber());
+            }
+        }
+    }
+
+    WHEN("A batch of numbers is requested")
+    {
+        SupportListDiscreteGenerator reference(
+            std::vector<double> {1.0, 0.0, 3.0, 4.0, 0.0},
+            42);
+
+        std::vector<int> batch(1000);
+        instance.getNumbers(batch.data(), batch.size());
+
+        THEN("The batch matches requesting the numbers one at a time")
+        {
+            for(auto &&number : batch) {
+                REQUIRE(number == reference.getNumber());
+            }
+        }
+    }
+}
+
+SCENARIO("SupportListDiscreteGenerator: construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("An instance constructed with only an engine")
+    {
+        SupportListDiscreteGenerator instance(std::make_shared<Engine>(42));
+
+        THEN("The distribution is as for DiscreteGenerator")
+        {
+            REQUIRE(instance.getDistributionVector() ==
+                    std::vector<double> {1.0, 1.0});
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(
+                SupportListDiscreteGenerator(std::shared_ptr<Engine>()),
+                std::invalid_argument);
+        }
+    }
+}
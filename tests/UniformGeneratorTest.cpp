@@ -1,6 +1,10 @@
 #include "UniformGenerator.hpp"
 
+#include "Engine.hpp"
+
 #include <catch2/catch.hpp>
+#include <limits>
+#include <vector>
 
 SCENARIO("UniformGenerator")
 {
@@ -74,3 +78,216 @@ SCENARIO("UniformGenerator")
         }
     }
 }
+
+SCENARIO("UniformGenerator: seeded construction")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances constructed with the same seed and range")
+    {
+        UniformGenerator first(0, 1000, 42);
+        UniformGenerator second(0, 1000, 42);
+
+        THEN("They produce identical sequences")
+        {
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == second.getNumber());
+            }
+        }
+    }
+
+    GIVEN("Two instances constructed with different seeds")
+    {
+        UniformGenerator first(0, 1000, 42);
+        UniformGenerator second(0, 1000, 43);
+
+        THEN("They produce different sequences")
+        {
+            std::vector<int> firstSet(100);
+            std::vector<int> secondSet(100);
+            for(size_t i = 0; i < firstSet.size(); i++) {
+                firstSet[i] = first.getNumber();
+                secondSet[i] = second.getNumber();
+            }
+            REQUIRE(firstSet != secondSet);
+        }
+    }
+
+    GIVEN("An instance constructed with only a seed")
+    {
+        UniformGenerator instance(42);
+
+        THEN("It uses the default range of 0 to 1")
+        {
+            for(int i = 0; i < 100; i++) {
+                int number = instance.getNumber();
+                REQUIRE(number >= 0);
+                REQUIRE(number <= 1);
+            }
+        }
+    }
+}
+
+SCENARIO("UniformGenerator: shared engine")
+{
+    using namespace aleatoric;
+
+    GIVEN("Two instances sharing an engine")
+    {
+        auto engine = std::make_shared<Engine>(42);
+        UniformGenerator first(0, 1000, engine);
+        UniformGenerator second(0, 1000, engine);
+
+        THEN("Their interleaved draws match the sequence of a single instance "
+             "with its own engine seeded the same")
+        {
+            UniformGenerator reference(0, 1000, 42);
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(first.getNumber() == reference.getNumber());
+                REQUIRE(second.getNumber() == reference.getNumber());
+            }
+        }
+    }
+
+    GIVEN("A null engine")
+    {
+        THEN("Construction throws")
+        {
+            REQUIRE_THROWS_AS(UniformGenerator(std::shared_ptr<Engine>()),
+                              std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("UniformGenerator: ranges given per call")
+{
+    using namespace aleatoric;
+
+    UniformGenerator instance(0, 1, 42);
+
+    WHEN("Numbers are requested with a range")
+    {
+        THEN("They are within that range and cover all of it")
+        {
+            std::vector<int> counts(5, 0);
+            for(int i = 0; i < 5000; i++) {
+                int number = instance.getNumber(-2, 2);
+                REQUIRE(number >= -2);
+                REQUIRE(number <= 2);
+                counts[number + 2]++;
+            }
+
+            for(auto &&count : counts) {
+                REQUIRE(count > 800);
+                REQUIRE(count < 1200);
+            }
+        }
+
+        THEN("The range set by setDistribution is unchanged")
+        {
+            instance.getNumber(10, 20);
+            for(int i = 0; i < 100; i++) {
+                int number = instance.getNumber();
+                REQUIRE(number >= 0);
+                REQUIRE(number <= 1);
+            }
+        }
+
+        THEN("They match numbers requested after setting the same range")
+        {
+            UniformGenerator reference(0, 1, 42);
+            reference.setDistribution(-2, 2);
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber(-2, 2) == reference.getNumber());
+            }
+        }
+    }
+
+    WHEN("The range covers every int")
+    {
+        THEN("Numbers from both halves of the range are produced")
+        {
+            bool haveNegative = false;
+            bool havePositive = false;
+            for(int i = 0; i < 100; i++) {
+                int number = instance.getNumber(
+                    std::numeric_limits<int>::min(),
+                    std::numeric_limits<int>::max());
+                haveNegative = haveNegative || number < 0;
+                havePositive = havePositive || number >= 0;
+            }
+
+            REQUIRE(haveNegative);
+            REQUIRE(havePositive);
+        }
+    }
+}
+
+SCENARIO("UniformGenerator: discarding numbers")
+{
+    using namespace aleatoric;
+
+    std::vector<std::pair<int, int>> ranges {{0, 7}, {-2, 2}, {1, 1000}};
+
+    THEN("Discarding matches requesting the same number of numbers, whether "
+         "or not the range size is a power of two")
+    {
+        for(auto &&range : ranges) {
+            for(int count : {0, 1, 300, 1000}) {
+                UniformGenerator instance(range.first, range.second, 42);
+                UniformGenerator reference(range.first, range.second, 42);
+
+                instance.discard(count);
+                for(int i = 0; i < count; i++) {
+                    reference.getNumber();
+                }
+
+                for(int i = 0; i < 100; i++) {
+                    REQUIRE(instance.getNumber() == reference.getNumber());
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("UniformGenerator: batches of numbers")
+{
+    using namespace aleatoric;
+
+    UniformGenerator instance(-2, 9, 42);
+    UniformGenerator reference(-2, 9, 42);
+
+    std::vector<int> batch(1000);
+    instance.getNumbers(batch.data(), batch.size());
+
+    THEN("The batch matches requesting the numbers one at a time")
+    {
+        for(auto &&number : batch) {
+            REQUIRE(number == reference.getNumber());
+        }
+        REQUIRE(instance.getNumber() == reference.getNumber());
+    }
+
+    WHEN("The range rejects many engine outputs, or covers every int")
+    {
+        // NB: a range of 3 * 2^30 values rejects a quarter of the outputs
+        std::vector<std::pair<int, int>> ranges {
+            {std::numeric_limits<int>::min(), 1073741823},
+            {std::numeric_limits<int>::min(), std::numeric_limits<int>::max()}};
+
+        THEN("Batches match requesting the numbers one at a time")
+        {
+            for(auto &&range : ranges) {
+                UniformGenerator wideInstance(range.first, range.second, 42);
+                UniformGenerator wideReference(range.first, range.second, 42);
+
+                wideInstance.getNumbers(batch.data(), batch.size());
+
+                for(auto &&number : batch) {
+                    REQUIRE(number == wideReference.getNumber());
+                }
+                REQUIRE(wideInstance.getNumber() == wideReference.getNumber());
+            }
+        }
+    }
+}
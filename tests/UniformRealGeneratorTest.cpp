@@ -1,6 +1,7 @@
 #include "UniformRealGenerator.hpp"
 
 #include <catch2/catch.hpp>
+#include <vector>
 
 SCENARIO("UniformRealGenerator: default constructor")
 {
@@ -69,3 +70,84 @@ SCENARIO("UniformRealGenerator: constructed with range params")
         }
     }
 }
+
+SCENARIO("UniformRealGenerator: seeded construction")
+{
+    using namespace aleatoric;
+
+    UniformRealGenerator first(33.33, 66.66, 42);
+    UniformRealGenerator second(33.33, 66.66, 42);
+
+    THEN("Instances with the same seed produce identical sequences")
+    {
+        for(int i = 0; i < 1000; i++) {
+            REQUIRE(first.getNumber() == second.getNumber());
+        }
+    }
+
+    THEN("An instance constructed with only a seed uses the default range")
+    {
+        UniformRealGenerator instance(42);
+        auto distribution = instance.getDistribution();
+        REQUIRE(distribution.first == 0.0);
+        REQUIRE(distribution.second == 1.0);
+    }
+}
+
+SCENARIO("UniformRealGenerator: ranges given per call")
+{
+    using namespace aleatoric;
+
+    UniformRealGenerator instance(0.0, 1.0, 42);
+
+    WHEN("Numbers are requested with a range")
+    {
+        THEN("They are within that range")
+        {
+            for(int i = 0; i < 1000; i++) {
+                auto number = instance.getNumber(-2.5, 2.5);
+                REQUIRE(number >= -2.5);
+                REQUIRE(number <= 2.5);
+            }
+        }
+
+        THEN("The range set by setDistribution is unchanged")
+        {
+            instance.getNumber(10.0, 20.0);
+            REQUIRE(instance.getDistribution() == std::make_pair(0.0, 1.0));
+        }
+
+        THEN("They match numbers requested after setting the same range")
+        {
+            UniformRealGenerator reference(42);
+            reference.setDistribution(-2.5, 2.5);
+            for(int i = 0; i < 1000; i++) {
+                REQUIRE(instance.getNumber(-2.5, 2.5) == reference.getNumber());
+            }
+        }
+    }
+
+    WHEN("A batch of numbers is filled")
+    {
+        std::vector<double> batch(1001);
+        instance.fill(batch.data(), batch.size(), 5.0, 10.0);
+
+        THEN("It matches the same number of individual requests")
+        {
+            UniformRealGenerator reference(42);
+            for(auto &&number : batch) {
+                REQUIRE(number == reference.getNumber(5.0, 10.0));
+            }
+        }
+
+        THEN("Requests after the batch carry on from it")
+        {
+            UniformRealGenerator reference(42);
+            for(size_t i = 0; i < batch.size(); i++) {
+                reference.getNumber();
+            }
+
+            REQUIRE(instance.getNumber() == reference.getNumber());
+        }
+    }
+}